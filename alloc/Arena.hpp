@@ -0,0 +1,119 @@
+#ifndef _RUSTISH_ALLOC_ARENA_HPP_
+#define _RUSTISH_ALLOC_ARENA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace rustish {
+namespace alloc {
+
+// Bump allocator for request scoped data. Allocation is a pointer increment
+// and individual frees are no-ops; reset() rewinds to the first chunk in O(1)
+// while keeping every chunk for reuse. Not thread safe.
+class Arena {
+    struct Chunk {
+        Chunk *next;
+        size_t size;
+
+        char *begin() { return reinterpret_cast<char *>(this + 1); }
+        char *end() { return begin() + size; }
+    };
+
+  public:
+    static constexpr size_t default_chunk_size = 64 * 1024;
+
+    explicit Arena(size_t chunk_size = default_chunk_size)
+        : m_chunk_size(chunk_size) {}
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    ~Arena() { release(); }
+
+    void *allocate(size_t size, size_t align) {
+        char *ptr = align_up(m_cursor, align);
+        if (m_current == nullptr || ptr + size > m_current->end()) {
+            next_chunk(size + align);
+            ptr = align_up(m_cursor, align);
+        }
+        m_cursor = ptr + size;
+        return ptr;
+    }
+
+    // Invalidates everything allocated so far. Destructors are not run.
+    void reset() {
+        m_current = m_head;
+        m_cursor = m_head ? m_head->begin() : nullptr;
+    }
+
+    // Returns every chunk to the global heap.
+    void release() {
+        while (m_head) {
+            Chunk *next = m_head->next;
+            ::operator delete(m_head);
+            m_head = next;
+        }
+        m_current = nullptr;
+        m_cursor = nullptr;
+    }
+
+    // Bytes handed out since the last reset, including alignment padding
+    // and the unused tails of earlier chunks.
+    size_t bytes_used() const {
+        size_t used = 0;
+        for (Chunk *c = m_head; c && c != m_current; c = c->next)
+            used += c->size;
+        if (m_current)
+            used += m_cursor - m_current->begin();
+        return used;
+    }
+
+  private:
+    static char *align_up(char *ptr, size_t align) {
+        uintptr_t p = reinterpret_cast<uintptr_t>(ptr);
+        return reinterpret_cast<char *>((p + align - 1) & ~(align - 1));
+    }
+
+    // Moves to the next retained chunk that fits, or appends a new one.
+    void next_chunk(size_t needed) {
+        Chunk *prev = m_current;
+        Chunk *c = m_current ? m_current->next : m_head;
+        while (c && c->size < needed) {
+            prev = c;
+            c = c->next;
+        }
+
+        if (c == nullptr) {
+            size_t size = needed > m_chunk_size ? needed : m_chunk_size;
+            c = static_cast<Chunk *>(::operator new(sizeof(Chunk) + size));
+            c->next = nullptr;
+            c->size = size;
+            if (prev)
+                prev->next = c;
+            else
+                m_head = c;
+        }
+
+        m_current = c;
+        m_cursor = c->begin();
+    }
+
+    size_t m_chunk_size;
+    Chunk *m_head = nullptr;
+    Chunk *m_current = nullptr;
+    char *m_cursor = nullptr;
+};
+
+// Allocation policy for values placed in an Arena. The arena is given at
+// construction time (see Box::new_in); freeing is deferred to Arena::reset.
+struct ArenaAlloc {
+    using resource = Arena;
+
+    static void deallocate(void *, size_t, size_t) {}
+};
+
+} // namespace alloc
+} // namespace rustish
+
+#endif //_RUSTISH_ALLOC_ARENA_HPP_
@@ -0,0 +1,45 @@
+#ifndef _RUSTISH_ALLOC_GLOBAL_HPP_
+#define _RUSTISH_ALLOC_GLOBAL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace rustish {
+namespace alloc {
+
+// Allocation policy backed by the global operator new/delete. Policies are
+// stateless so the containers using them stay the size of a pointer.
+struct Global {
+    static void *allocate(size_t size, size_t align) {
+        if (align <= alignof(std::max_align_t))
+            return ::operator new(size);
+#ifdef __cpp_aligned_new
+        return ::operator new(size, std::align_val_t(align));
+#else
+        // Over-allocate and keep the original pointer just below the block.
+        void *raw = ::operator new(size + align + sizeof(void *));
+        uintptr_t p = reinterpret_cast<uintptr_t>(raw) + sizeof(void *);
+        void **ptr = reinterpret_cast<void **>((p + align - 1) & ~(align - 1));
+        ptr[-1] = raw;
+        return ptr;
+#endif
+    }
+
+    static void deallocate(void *ptr, size_t, size_t align) {
+        if (align <= alignof(std::max_align_t)) {
+            ::operator delete(ptr);
+            return;
+        }
+#ifdef __cpp_aligned_new
+        ::operator delete(ptr, std::align_val_t(align));
+#else
+        ::operator delete(static_cast<void **>(ptr)[-1]);
+#endif
+    }
+};
+
+} // namespace alloc
+} // namespace rustish
+
+#endif //_RUSTISH_ALLOC_GLOBAL_HPP_
@@ -0,0 +1,148 @@
+#ifndef _RUSTISH_ALLOC_POOL_HPP_
+#define _RUSTISH_ALLOC_POOL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace rustish {
+namespace alloc {
+
+// Size class allocator. Blocks are carved out of large aligned chunks and
+// recycled through one free list per 16 byte size class, so allocate and
+// deallocate are a couple of pointer moves. Every chunk starts with a header
+// naming its pool, which lets a block be returned without the caller keeping
+// a pool pointer around. Not thread safe.
+class Pool {
+    struct Chunk {
+        Pool *owner;
+        Chunk *next;
+        void *raw;
+    };
+
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+  public:
+    static constexpr size_t granularity = 16;
+    static constexpr size_t max_size = 1024;
+    static constexpr size_t chunk_size = 64 * 1024;
+
+    Pool() {
+        for (auto &head : m_free)
+            head = nullptr;
+    }
+
+    Pool(const Pool &) = delete;
+    Pool &operator=(const Pool &) = delete;
+
+    ~Pool() { release(); }
+
+    void *allocate(size_t size, size_t align) {
+        if (size > max_size || align > granularity)
+            throw std::bad_alloc();
+
+        size_t cls = size_class(size);
+        if (FreeBlock *block = m_free[cls]) {
+            m_free[cls] = block->next;
+            return block;
+        }
+
+        size_t bytes = (cls + 1) * granularity;
+        if (m_cursor == nullptr || m_cursor + bytes > m_end)
+            new_chunk();
+        void *ptr = m_cursor;
+        m_cursor += bytes;
+        return ptr;
+    }
+
+    void deallocate(void *ptr, size_t size) {
+        size_t cls = size_class(size);
+        FreeBlock *block = static_cast<FreeBlock *>(ptr);
+        block->next = m_free[cls];
+        m_free[cls] = block;
+    }
+
+    // Pool that handed out ptr.
+    static Pool *owner_of(void *ptr) {
+        uintptr_t p = reinterpret_cast<uintptr_t>(ptr);
+        return reinterpret_cast<Chunk *>(p & ~(chunk_size - 1))->owner;
+    }
+
+    // Frees every chunk at once, invalidating all outstanding blocks.
+    void release() {
+        while (m_chunks) {
+            Chunk *next = m_chunks->next;
+            free_chunk(m_chunks);
+            m_chunks = next;
+        }
+        for (auto &head : m_free)
+            head = nullptr;
+        m_cursor = nullptr;
+        m_end = nullptr;
+    }
+
+  private:
+    static constexpr size_t num_classes = max_size / granularity;
+
+    static size_t size_class(size_t size) {
+        return size == 0 ? 0 : (size - 1) / granularity;
+    }
+
+    static size_t header_size() {
+        return (sizeof(Chunk) + granularity - 1) & ~(granularity - 1);
+    }
+
+    // Chunks are aligned to their own size so owner_of() can find the
+    // header by masking the low bits of a block address.
+    void new_chunk() {
+        void *raw;
+        char *base;
+#ifdef __cpp_aligned_new
+        raw = ::operator new(chunk_size, std::align_val_t(chunk_size));
+        base = static_cast<char *>(raw);
+#else
+        raw = ::operator new(2 * chunk_size);
+        uintptr_t p = reinterpret_cast<uintptr_t>(raw);
+        base = reinterpret_cast<char *>((p + chunk_size - 1) &
+                                        ~(chunk_size - 1));
+#endif
+        Chunk *chunk = reinterpret_cast<Chunk *>(base);
+        chunk->owner = this;
+        chunk->next = m_chunks;
+        chunk->raw = raw;
+        m_chunks = chunk;
+        m_cursor = base + header_size();
+        m_end = base + chunk_size;
+    }
+
+    static void free_chunk(Chunk *chunk) {
+#ifdef __cpp_aligned_new
+        ::operator delete(chunk->raw, std::align_val_t(chunk_size));
+#else
+        ::operator delete(chunk->raw);
+#endif
+    }
+
+    FreeBlock *m_free[num_classes];
+    Chunk *m_chunks = nullptr;
+    char *m_cursor = nullptr;
+    char *m_end = nullptr;
+};
+
+// Allocation policy for values placed in a Pool. The pool is given at
+// construction time (see Box::new_in) and found again from the block
+// address when the value is freed.
+struct PoolAlloc {
+    using resource = Pool;
+
+    static void deallocate(void *ptr, size_t size, size_t) {
+        Pool::owner_of(ptr)->deallocate(ptr, size);
+    }
+};
+
+} // namespace alloc
+} // namespace rustish
+
+#endif //_RUSTISH_ALLOC_POOL_HPP_
@@ -0,0 +1,105 @@
+#ifndef _RUSTISH_ALLOC_THREAD_CACHE_HPP_
+#define _RUSTISH_ALLOC_THREAD_CACHE_HPP_
+
+#include "Global.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rustish {
+namespace alloc {
+
+// Allocation policy that recycles blocks through per-thread free lists, one
+// per 64 byte size class up to max_size. Unlike Pool it needs no resource
+// at allocation time, so it suits containers that allocate on their own
+// (such as boxed Option storage). A block may be freed on any thread and
+// joins that thread's list; each list keeps at most max_cached blocks and
+// the rest go back to the global heap, as does everything a thread still
+// holds when it exits. Larger or over-aligned requests use Global.
+struct ThreadCache {
+    static constexpr size_t granularity = 64;
+    static constexpr size_t max_size = 16 * 1024;
+    static constexpr size_t max_cached = 64;
+
+    static void *allocate(size_t size, size_t align) {
+        if (!cacheable(size, align))
+            return Global::allocate(size, align);
+
+        Lists &lists = local();
+        size_t cls = size_class(size);
+        if (FreeBlock *block = lists.heads[cls]) {
+            lists.heads[cls] = block->next;
+            --lists.counts[cls];
+            return block;
+        }
+        return Global::allocate(class_bytes(cls), align);
+    }
+
+    static void deallocate(void *ptr, size_t size, size_t align) {
+        if (!cacheable(size, align)) {
+            Global::deallocate(ptr, size, align);
+            return;
+        }
+
+        Lists &lists = local();
+        size_t cls = size_class(size);
+        if (lists.counts[cls] == max_cached) {
+            Global::deallocate(ptr, class_bytes(cls), align);
+            return;
+        }
+        FreeBlock *block = static_cast<FreeBlock *>(ptr);
+        block->next = lists.heads[cls];
+        lists.heads[cls] = block;
+        ++lists.counts[cls];
+    }
+
+    // Blocks cached by the calling thread, for tests and diagnostics.
+    static size_t cached() {
+        size_t n = 0;
+        for (uint32_t count : local().counts)
+            n += count;
+        return n;
+    }
+
+  private:
+    static constexpr size_t num_classes = max_size / granularity;
+
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    struct Lists {
+        FreeBlock *heads[num_classes] = {};
+        uint32_t counts[num_classes] = {};
+
+        ~Lists() {
+            for (size_t cls = 0; cls < num_classes; ++cls) {
+                while (FreeBlock *block = heads[cls]) {
+                    heads[cls] = block->next;
+                    Global::deallocate(block, class_bytes(cls),
+                                       alignof(std::max_align_t));
+                }
+            }
+        }
+    };
+
+    static bool cacheable(size_t size, size_t align) {
+        return size <= max_size && align <= alignof(std::max_align_t);
+    }
+
+    static size_t size_class(size_t size) {
+        return size == 0 ? 0 : (size - 1) / granularity;
+    }
+
+    static size_t class_bytes(size_t cls) { return (cls + 1) * granularity; }
+
+    static Lists &local() {
+        static thread_local Lists lists;
+        return lists;
+    }
+};
+
+} // namespace alloc
+} // namespace rustish
+
+#endif //_RUSTISH_ALLOC_THREAD_CACHE_HPP_
@@ -0,0 +1,98 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "alloc/Arena.hpp"
+#include "alloc/Pool.hpp"
+#include "boxed/Box.hpp"
+
+#include <memory>
+#include <string>
+
+using namespace rustish::alloc;
+using namespace rustish::boxed;
+using namespace rustish::option;
+
+namespace {
+
+const int kDepths[] = {10, 16, 20};
+
+struct UniqueNode {
+    long value;
+    Option<std::unique_ptr<UniqueNode>> left, right;
+};
+
+std::unique_ptr<UniqueNode> build_unique(int depth, long value) {
+    std::unique_ptr<UniqueNode> node(new UniqueNode{value, {}, {}});
+    if (depth > 1) {
+        node->left = Some(build_unique(depth - 1, value * 2));
+        node->right = Some(build_unique(depth - 1, value * 2 + 1));
+    }
+    return node;
+}
+
+template <typename Alloc> struct BoxNode {
+    long value;
+    Option<Box<BoxNode, Alloc>> left, right;
+};
+
+template <typename Alloc, typename Make>
+Box<BoxNode<Alloc>, Alloc> build_box(int depth, long value, Make &make) {
+    Box<BoxNode<Alloc>, Alloc> node = make(value);
+    if (depth > 1) {
+        node->left = Some(build_box<Alloc>(depth - 1, value * 2, make));
+        node->right = Some(build_box<Alloc>(depth - 1, value * 2 + 1, make));
+    }
+    return node;
+}
+
+std::string label(const char *what, int depth) {
+    return std::string(what) + " depth=" + std::to_string(depth);
+}
+
+} // namespace
+
+TEST_CASE("Box tree build and teardown against unique_ptr", "[benchmark]") {
+    for (int depth : kDepths) {
+        BENCHMARK(label("unique_ptr + new", depth)) {
+            return build_unique(depth, 1)->value;
+        };
+
+        BENCHMARK(label("Box global", depth)) {
+            auto make = [](long v) {
+                return Box<BoxNode<Global>>::new_(BoxNode<Global>{v, {}, {}});
+            };
+            return build_box<Global>(depth, 1, make)->value;
+        };
+
+        Pool pool;
+        BENCHMARK(label("Box pool", depth)) {
+            auto make = [&](long v) {
+                return Box<BoxNode<PoolAlloc>, PoolAlloc>::new_in(
+                    pool, BoxNode<PoolAlloc>{v, {}, {}});
+            };
+            return build_box<PoolAlloc>(depth, 1, make)->value;
+        };
+
+        // Nodes own nothing but other nodes, so the whole tree is dropped
+        // by rewinding the arena instead of visiting every node.
+        Arena arena;
+        BENCHMARK(label("Box arena", depth)) {
+            auto make = [&](long v) {
+                return Box<BoxNode<ArenaAlloc>, ArenaAlloc>::new_in(
+                    arena, BoxNode<ArenaAlloc>{v, {}, {}});
+            };
+            long value = build_box<ArenaAlloc>(depth, 1, make).leak().value;
+            arena.reset();
+            return value;
+        };
+    }
+}
+
+TEST_CASE("Option<Box<T>> size against Option<unique_ptr<T>>",
+          "[benchmark]") {
+    static_assert(sizeof(Option<Box<long>>) == sizeof(long *),
+                  "Option<Box<T>> should use the null niche");
+    WARN("sizeof(Option<unique_ptr<long>>) = "
+         << sizeof(Option<std::unique_ptr<long>>)
+         << ", sizeof(Option<Box<long>>) = " << sizeof(Option<Box<long>>));
+}
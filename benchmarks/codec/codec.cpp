@@ -0,0 +1,106 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "codec/Decoder.hpp"
+#include "codec/Encoder.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace rustish::codec;
+using namespace rustish::option;
+
+namespace {
+
+const size_t kCount = 1u << 20;
+const unsigned kNonePercent[] = {0, 10, 50, 90};
+
+std::vector<Option<uint64_t>> make_column(unsigned none_percent) {
+    std::vector<Option<uint64_t>> column;
+    column.reserve(kCount);
+    uint64_t state = 1;
+    for (size_t i = 0; i < kCount; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        if ((state >> 33) % 100 < none_percent)
+            column.push_back(None());
+        else
+            column.push_back(Option<uint64_t>(state >> 44));
+    }
+    return column;
+}
+
+// What the callers do today: one presence byte and a fixed width payload
+// per field.
+size_t encode_presence_bytes(const std::vector<Option<uint64_t>> &column,
+                             uint8_t *out) {
+    size_t pos = 0;
+    for (const Option<uint64_t> &v : column) {
+        out[pos++] = v.is_some();
+        if (v.is_some()) {
+            uint64_t x = v.as_ref().unwrap();
+            std::memcpy(out + pos, &x, sizeof(x));
+            pos += sizeof(x);
+        }
+    }
+    return pos;
+}
+
+// Labels carry the encoded size so GB/s is bytes divided by the mean time.
+std::string label(const char *what, unsigned none_percent, size_t bytes) {
+    return std::string(what) + " none=" + std::to_string(none_percent) +
+           "% bytes=" + std::to_string(bytes);
+}
+
+} // namespace
+
+TEST_CASE("Option column encode/decode throughput", "[benchmark]") {
+    std::vector<uint64_t> storage(kCount * 2 + 16);
+    uint8_t *buf = reinterpret_cast<uint8_t *>(storage.data());
+    size_t cap = storage.size() * sizeof(uint64_t);
+
+    for (unsigned none_percent : kNonePercent) {
+        std::vector<Option<uint64_t>> column = make_column(none_percent);
+        std::vector<Option<uint64_t>> decoded(kCount);
+
+        size_t baseline_len = encode_presence_bytes(column, buf);
+        BENCHMARK(label("presence byte encode", none_percent, baseline_len)) {
+            return encode_presence_bytes(column, buf);
+        };
+
+        Encoder sizing(buf, cap);
+        sizing.write_option_column(column.data(), column.size());
+        size_t varint_len = sizing.len();
+
+        BENCHMARK(label("varint encode", none_percent, varint_len)) {
+            Encoder enc(buf, cap);
+            enc.write_option_column(column.data(), column.size());
+            return enc.len();
+        };
+
+        BENCHMARK(label("varint decode", none_percent, varint_len)) {
+            Decoder dec(buf, varint_len);
+            dec.read_option_column(decoded.data(), decoded.size());
+            return dec.ok();
+        };
+
+        Encoder raw(buf, cap);
+        raw.begin_options(column.size());
+        for (const Option<uint64_t> &v : column)
+            raw.write_option_raw(v);
+        size_t raw_len = raw.len();
+
+        BENCHMARK(label("zero-copy decode+sum", none_percent, raw_len)) {
+            Decoder dec(buf, raw_len);
+            dec.begin_options(kCount);
+            uint64_t sum = 0;
+            for (size_t i = 0; i < kCount; ++i) {
+                Option<const uint64_t &> v = dec.read_option_ref<uint64_t>();
+                if (v.is_some())
+                    sum += v.unwrap_unchecked();
+            }
+            return sum;
+        };
+    }
+}
@@ -0,0 +1,215 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "codec/Parse.hpp"
+#include "collections/Vec.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#define BENCH_HAS_FROM_CHARS 1
+#endif
+#endif
+
+using namespace rustish::codec;
+using namespace rustish::option;
+
+namespace {
+
+const size_t kFields = 1u << 18;
+
+struct Field {
+    uint32_t offset;
+    uint32_t len;
+};
+
+// Newline separated fields as they arrive from ingest, about 1% of them
+// malformed. Fields are located up front so the loops below time parsing
+// alone.
+struct Input {
+    std::string text;
+    std::vector<Field> fields;
+};
+
+Input make_input(unsigned min_digits, unsigned max_digits) {
+    Input in;
+    uint64_t state = 1;
+    for (size_t i = 0; i < kFields; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        unsigned digits =
+            min_digits + (state >> 40) % (max_digits - min_digits + 1);
+        uint64_t value = (state >> 1) % 10000000000000000000ull;
+        std::string field = std::to_string(value).substr(0, digits);
+        if ((state >> 20) % 4 == 0)
+            field.insert(0, "-");
+        if ((state >> 24) % 100 == 0)
+            field.back() = 'x';
+
+        in.fields.push_back({static_cast<uint32_t>(in.text.size()),
+                             static_cast<uint32_t>(field.size())});
+        in.text += field;
+        in.text += '\n';
+    }
+    return in;
+}
+
+Input make_decimals() {
+    Input in;
+    uint64_t state = 7;
+    char buf[64];
+    for (size_t i = 0; i < kFields; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        double value = static_cast<double>(state >> 11) / 9007199254740992.0 *
+                       ((state & 3) ? 1000.0 : 1e9);
+        int len = std::snprintf(buf, sizeof(buf), "%.*f",
+                                static_cast<int>(state % 7), value);
+        in.fields.push_back({static_cast<uint32_t>(in.text.size()),
+                             static_cast<uint32_t>(len)});
+        in.text.append(buf, static_cast<size_t>(len));
+        in.text += '\n';
+    }
+    return in;
+}
+
+std::string label(const char *what, const char *input) {
+    return std::string(what) + " " + input + " n=" + std::to_string(kFields);
+}
+
+void integer_benchmarks(const Input &in, const char *name) {
+    const char *text = in.text.data();
+
+    BENCHMARK(label("strtoll", name)) {
+        int64_t sum = 0;
+        size_t bad = 0;
+        for (const Field &f : in.fields) {
+            const char *first = text + f.offset;
+            char *end;
+            errno = 0;
+            long long v = std::strtoll(first, &end, 10);
+            if (end != first + f.len || f.len == 0 || errno == ERANGE)
+                ++bad;
+            else
+                sum += v;
+        }
+        return sum + static_cast<int64_t>(bad);
+    };
+
+    // What the ingest does today: a string per field and an exception for
+    // every malformed one.
+    BENCHMARK(label("std::stoll", name)) {
+        int64_t sum = 0;
+        size_t bad = 0;
+        for (const Field &f : in.fields) {
+            std::string field(text + f.offset, f.len);
+            try {
+                size_t pos;
+                long long v = std::stoll(field, &pos);
+                if (pos != field.size())
+                    ++bad;
+                else
+                    sum += v;
+            } catch (const std::exception &) {
+                ++bad;
+            }
+        }
+        return sum + static_cast<int64_t>(bad);
+    };
+
+#if BENCH_HAS_FROM_CHARS
+    BENCHMARK(label("std::from_chars", name)) {
+        int64_t sum = 0;
+        size_t bad = 0;
+        for (const Field &f : in.fields) {
+            const char *first = text + f.offset;
+            int64_t v;
+            std::from_chars_result r = std::from_chars(first, first + f.len, v);
+            if (r.ec != std::errc() || r.ptr != first + f.len)
+                ++bad;
+            else
+                sum += v;
+        }
+        return sum + static_cast<int64_t>(bad);
+    };
+#endif
+
+    BENCHMARK(label("parse<int64_t>", name)) {
+        int64_t sum = 0;
+        size_t bad = 0;
+        for (const Field &f : in.fields) {
+            const char *first = text + f.offset;
+            Option<int64_t> v = parse<int64_t>(first, first + f.len);
+            if (v.is_none())
+                ++bad;
+            else
+                sum += v.unwrap_unchecked();
+        }
+        return sum + static_cast<int64_t>(bad);
+    };
+
+    // Splitting included, into a nullable column.
+    BENCHMARK(label("parse_delimited<int64_t> into Vec", name)) {
+        rustish::collections::Vec<Option<int64_t>> column =
+            rustish::collections::Vec<Option<int64_t>>::with_capacity(kFields);
+        parse_delimited<int64_t>(text, in.text.size(), '\n', column);
+        return column.len();
+    };
+}
+
+} // namespace
+
+TEST_CASE("Parse short integers", "[benchmark]") {
+    integer_benchmarks(make_input(1, 6), "1-6 digits");
+}
+
+TEST_CASE("Parse long integers", "[benchmark]") {
+    integer_benchmarks(make_input(10, 18), "10-18 digits");
+}
+
+TEST_CASE("Parse decimals", "[benchmark]") {
+    Input in = make_decimals();
+    const char *text = in.text.data();
+
+    BENCHMARK(label("strtod", "decimals")) {
+        double sum = 0;
+        for (const Field &f : in.fields) {
+            char *end;
+            double v = std::strtod(text + f.offset, &end);
+            if (end == text + f.offset + f.len)
+                sum += v;
+        }
+        return sum;
+    };
+
+#if BENCH_HAS_FROM_CHARS && RUSTISH_PARSE_FLOAT_FROM_CHARS
+    BENCHMARK(label("std::from_chars", "decimals")) {
+        double sum = 0;
+        for (const Field &f : in.fields) {
+            const char *first = text + f.offset;
+            double v;
+            std::from_chars_result r = std::from_chars(first, first + f.len, v);
+            if (r.ec == std::errc() && r.ptr == first + f.len)
+                sum += v;
+        }
+        return sum;
+    };
+#endif
+
+    BENCHMARK(label("parse<double>", "decimals")) {
+        double sum = 0;
+        for (const Field &f : in.fields) {
+            const char *first = text + f.offset;
+            Option<double> v = parse<double>(first, first + f.len);
+            if (v.is_some())
+                sum += v.unwrap_unchecked();
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,132 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "collections/HashMap.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace rustish::collections;
+
+namespace {
+
+// Table sizes from 1K to 1M entries. Larger tables (up to the 100M entry
+// runs) only need kSizes extended; they are left out so the default run
+// finishes in a few minutes.
+const size_t kSizes[] = {1u << 10, 1u << 14, 1u << 17, 1u << 20};
+
+std::vector<uint64_t> random_keys(size_t n, uint64_t seed) {
+    std::vector<uint64_t> keys(n);
+    uint64_t state = seed;
+    for (auto &k : keys) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        k = state;
+    }
+    return keys;
+}
+
+std::string label(const char *what, size_t n) {
+    return std::string(what) + " n=" + std::to_string(n);
+}
+
+} // namespace
+
+TEST_CASE("HashMap lookup against std::unordered_map", "[benchmark]") {
+    for (size_t n : kSizes) {
+        std::vector<uint64_t> keys = random_keys(n, 1);
+        std::vector<uint64_t> misses = random_keys(n, 2);
+        std::vector<uint64_t> order = keys;
+        std::reverse(order.begin(), order.end());
+
+        HashMap<uint64_t, uint64_t> map;
+        std::unordered_map<uint64_t, uint64_t> std_map;
+        for (uint64_t k : keys) {
+            map.insert(k, k);
+            std_map.emplace(k, k);
+        }
+
+        BENCHMARK(label("HashMap hit", n)) {
+            uint64_t sum = 0;
+            for (uint64_t k : order)
+                sum += map.get(k).unwrap_unchecked();
+            return sum;
+        };
+
+        BENCHMARK(label("unordered_map hit", n)) {
+            uint64_t sum = 0;
+            for (uint64_t k : order)
+                sum += std_map.find(k)->second;
+            return sum;
+        };
+
+        BENCHMARK(label("HashMap miss", n)) {
+            size_t found = 0;
+            for (uint64_t k : misses)
+                found += map.get(k).is_some();
+            return found;
+        };
+
+        BENCHMARK(label("unordered_map miss", n)) {
+            size_t found = 0;
+            for (uint64_t k : misses)
+                found += std_map.find(k) != std_map.end();
+            return found;
+        };
+    }
+}
+
+TEST_CASE("HashMap insert against std::unordered_map", "[benchmark]") {
+    for (size_t n : kSizes) {
+        std::vector<uint64_t> keys = random_keys(n, 3);
+
+        BENCHMARK(label("HashMap insert", n)) {
+            HashMap<uint64_t, uint64_t> map;
+            for (uint64_t k : keys)
+                map.insert(k, k);
+            return map.len();
+        };
+
+        BENCHMARK(label("unordered_map insert", n)) {
+            std::unordered_map<uint64_t, uint64_t> map;
+            for (uint64_t k : keys)
+                map.emplace(k, k);
+            return map.size();
+        };
+    }
+}
+
+TEST_CASE("HashMap erase against std::unordered_map", "[benchmark]") {
+    for (size_t n : kSizes) {
+        std::vector<uint64_t> keys = random_keys(n, 4);
+
+        BENCHMARK_ADVANCED(label("HashMap erase", n))
+        (Catch::Benchmark::Chronometer meter) {
+            std::vector<HashMap<uint64_t, uint64_t>> maps(meter.runs());
+            for (auto &map : maps)
+                for (uint64_t k : keys)
+                    map.insert(k, k);
+            meter.measure([&](int i) {
+                for (uint64_t k : keys)
+                    maps[i].remove(k);
+                return maps[i].len();
+            });
+        };
+
+        BENCHMARK_ADVANCED(label("unordered_map erase", n))
+        (Catch::Benchmark::Chronometer meter) {
+            std::vector<std::unordered_map<uint64_t, uint64_t>> maps(
+                meter.runs());
+            for (auto &map : maps)
+                for (uint64_t k : keys)
+                    map.emplace(k, k);
+            meter.measure([&](int i) {
+                for (uint64_t k : keys)
+                    maps[i].erase(k);
+                return maps[i].size();
+            });
+        };
+    }
+}
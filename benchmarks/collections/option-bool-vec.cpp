@@ -0,0 +1,81 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "collections/OptionBoolVec.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace rustish::collections;
+using namespace rustish::option;
+
+namespace {
+
+const size_t kSizes[] = {1u << 16, 1u << 20, 1u << 23};
+
+// Option<uint8_t> still uses the tagged layout, which is what Option<bool>
+// looked like before it got a niche.
+using TaggedBool = Option<uint8_t>;
+
+Option<bool> pattern(uint64_t &state) {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    switch ((state >> 40) % 3) {
+    case 0:
+        return None();
+    case 1:
+        return Some(true);
+    default:
+        return Some(false);
+    }
+}
+
+std::string label(const char *what, size_t n) {
+    return std::string(what) + " n=" + std::to_string(n);
+}
+
+} // namespace
+
+TEST_CASE("Tri-state flag storage and scan", "[benchmark]") {
+    for (size_t n : kSizes) {
+        std::vector<TaggedBool> tagged;
+        std::vector<Option<bool>> packed;
+        OptionBoolVec bits;
+        tagged.reserve(n);
+        packed.reserve(n);
+        bits.reserve(n);
+
+        uint64_t state = 1;
+        for (size_t i = 0; i < n; ++i) {
+            Option<bool> flag = pattern(state);
+            tagged.push_back(flag.as_ref().map([](const bool &b) {
+                return static_cast<uint8_t>(b);
+            }));
+            packed.push_back(flag);
+            bits.push(flag);
+        }
+
+        WARN(label("bytes", n)
+             << ": tagged " << tagged.size() * sizeof(TaggedBool)
+             << ", Option<bool> " << packed.size() * sizeof(Option<bool>)
+             << ", OptionBoolVec " << bits.heap_bytes());
+
+        BENCHMARK(label("tagged count true", n)) {
+            size_t count = 0;
+            for (const TaggedBool &flag : tagged)
+                count += flag.is_some() && flag.as_ref().unwrap() != 0;
+            return count;
+        };
+
+        BENCHMARK(label("Option<bool> count true", n)) {
+            size_t count = 0;
+            for (const Option<bool> &flag : packed)
+                count += flag.is_some() && flag.as_ref().unwrap();
+            return count;
+        };
+
+        BENCHMARK(label("OptionBoolVec count true", n)) {
+            return bits.count_true();
+        };
+    }
+}
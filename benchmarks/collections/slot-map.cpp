@@ -0,0 +1,93 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "collections/SlotMap.hpp"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace rustish::collections;
+
+namespace {
+
+const size_t kSizes[] = {1u << 10, 1u << 14, 1u << 17, 1u << 20};
+
+struct Entity {
+    uint64_t id;
+    double x, y, z;
+};
+
+std::string label(const char *what, size_t n) {
+    return std::string(what) + " n=" + std::to_string(n);
+}
+
+} // namespace
+
+TEST_CASE("SlotMap insert/remove churn against std::unordered_map",
+          "[benchmark]") {
+    for (size_t n : kSizes) {
+        // Keep n live entries and replace a pseudo random one per step.
+        SlotMap<Entity> slots;
+        std::vector<SlotKey> keys;
+        std::unordered_map<uint64_t, Entity> table;
+        std::vector<uint64_t> ids;
+        for (size_t i = 0; i < n; ++i) {
+            keys.push_back(slots.insert(Entity{i, 0, 0, 0}));
+            table.emplace(i, Entity{i, 0, 0, 0});
+            ids.push_back(i);
+        }
+
+        BENCHMARK(label("SlotMap churn", n)) {
+            uint64_t state = 7;
+            for (size_t i = 0; i < n; ++i) {
+                state = state * 6364136223846793005ull + 1;
+                size_t victim = (state >> 33) % n;
+                Entity e = slots.remove(keys[victim]).unwrap();
+                keys[victim] = slots.insert(e);
+            }
+            return slots.len();
+        };
+
+        uint64_t next_id = n;
+        BENCHMARK(label("unordered_map churn", n)) {
+            uint64_t state = 7;
+            for (size_t i = 0; i < n; ++i) {
+                state = state * 6364136223846793005ull + 1;
+                size_t victim = (state >> 33) % n;
+                auto it = table.find(ids[victim]);
+                Entity e = it->second;
+                table.erase(it);
+                ids[victim] = next_id++;
+                table.emplace(ids[victim], e);
+            }
+            return table.size();
+        };
+    }
+}
+
+TEST_CASE("SlotMap iteration against std::unordered_map", "[benchmark]") {
+    for (size_t n : kSizes) {
+        SlotMap<Entity> slots;
+        std::unordered_map<uint64_t, Entity> table;
+        for (size_t i = 0; i < n; ++i) {
+            slots.insert(Entity{i, 1.0, 2.0, 3.0});
+            table.emplace(i, Entity{i, 1.0, 2.0, 3.0});
+        }
+
+        BENCHMARK(label("SlotMap iterate", n)) {
+            double sum = 0;
+            for (const Entity &e : slots)
+                sum += e.x + e.y + e.z;
+            return sum;
+        };
+
+        BENCHMARK(label("unordered_map iterate", n)) {
+            double sum = 0;
+            for (const auto &e : table)
+                sum += e.second.x + e.second.y + e.second.z;
+            return sum;
+        };
+    }
+}
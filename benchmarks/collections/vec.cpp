@@ -0,0 +1,140 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "collections/Vec.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace rustish::collections;
+using namespace rustish::option;
+
+namespace {
+
+const size_t kLen = 1u << 20;
+const size_t kLists = 1u << 16;
+
+std::string label(const char *what, size_t n) {
+    return std::string(what) + " n=" + std::to_string(n);
+}
+
+// Lengths of short per-item lists (tokens, edges, tags), mostly under 8.
+std::vector<uint8_t> list_lengths() {
+    std::vector<uint8_t> lens(kLists);
+    uint64_t state = 1;
+    for (uint8_t &len : lens) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        uint8_t r = static_cast<uint8_t>(state >> 56);
+        len = r < 240 ? r % 8 : 8 + r % 24;
+    }
+    return lens;
+}
+
+} // namespace
+
+TEST_CASE("Indexed scan with checked access", "[benchmark]") {
+    std::vector<uint64_t> std_vec(kLen);
+    Vec<uint64_t> vec = Vec<uint64_t>::with_capacity(kLen);
+    for (size_t i = 0; i < kLen; ++i) {
+        std_vec[i] = i * 7;
+        vec.push(i * 7);
+    }
+
+    BENCHMARK(label("std::vector operator[]", kLen)) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < std_vec.size(); ++i)
+            sum += std_vec[i];
+        return sum;
+    };
+
+    BENCHMARK(label("std::vector at()", kLen)) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < std_vec.size(); ++i)
+            sum += std_vec.at(i);
+        return sum;
+    };
+
+    BENCHMARK(label("Vec get().unwrap()", kLen)) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < vec.len(); ++i)
+            sum += vec.get(i).unwrap();
+        return sum;
+    };
+
+    // Strided access that may run off the end is where the check matters.
+    BENCHMARK(label("Vec get() strided, may be None", kLen)) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < vec.len(); ++i) {
+            Option<uint64_t &> v = vec.get(i * 3 / 2);
+            if (v.is_some())
+                sum += v.unwrap_unchecked();
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("Drain as a stack", "[benchmark]") {
+    BENCHMARK(label("std::vector back() + pop_back()", kLen)) {
+        std::vector<uint64_t> stack(kLen, 3);
+        uint64_t sum = 0;
+        while (!stack.empty()) {
+            sum += stack.back();
+            stack.pop_back();
+        }
+        return sum;
+    };
+
+    BENCHMARK(label("Vec pop()", kLen)) {
+        Vec<uint64_t> stack = Vec<uint64_t>::with_capacity(kLen);
+        for (size_t i = 0; i < kLen; ++i)
+            stack.push(3);
+        uint64_t sum = 0;
+        for (Option<uint64_t> top = stack.pop(); top.is_some();
+             top = stack.pop())
+            sum += top.unwrap_unchecked();
+        return sum;
+    };
+}
+
+// The workload small_vector types target: many short lists built and
+// dropped, almost all fitting the inline capacity.
+TEST_CASE("Short lists built and dropped", "[benchmark]") {
+    std::vector<uint8_t> lens = list_lengths();
+
+    BENCHMARK(label("std::vector<uint32_t>", kLists)) {
+        uint64_t sum = 0;
+        for (uint8_t len : lens) {
+            std::vector<uint32_t> list;
+            for (uint32_t i = 0; i < len; ++i)
+                list.push_back(i);
+            for (uint32_t v : list)
+                sum += v;
+        }
+        return sum;
+    };
+
+    BENCHMARK(label("Vec<uint32_t>", kLists)) {
+        uint64_t sum = 0;
+        for (uint8_t len : lens) {
+            Vec<uint32_t> list;
+            for (uint32_t i = 0; i < len; ++i)
+                list.push(i);
+            for (uint32_t v : list)
+                sum += v;
+        }
+        return sum;
+    };
+
+    BENCHMARK(label("SmallVec<uint32_t, 8>", kLists)) {
+        uint64_t sum = 0;
+        for (uint8_t len : lens) {
+            SmallVec<uint32_t, 8> list;
+            for (uint32_t i = 0; i < len; ++i)
+                list.push(i);
+            for (uint32_t v : list)
+                sum += v;
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,66 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "exec/Find.hpp"
+
+#include <cstdint>
+#include <string>
+
+using namespace rustish::exec;
+using namespace rustish::option;
+
+namespace {
+
+// The input is generated from the index, so 1e9 elements need no memory.
+const size_t kElements = 1000000000;
+const double kHitAt[] = {0.001, 0.5, 0.999};
+
+std::string label(const char *what, double at) {
+    return std::string(what) + " hit=" +
+           (at < 0 ? std::string("none") : std::to_string(at)) +
+           " n=" + std::to_string(kElements);
+}
+
+// Cheap per element work with a single hit at target.
+struct Probe {
+    size_t target;
+
+    Option<uint64_t> operator()(size_t i) const {
+        uint64_t x = i * 0x9E3779B97F4A7C15ull;
+        if (i == target)
+            return Option<uint64_t>(x);
+        return {};
+    }
+};
+
+Option<uint64_t> serial(Probe probe) {
+    for (size_t i = 0; i < kElements; ++i) {
+        Option<uint64_t> found = probe(i);
+        if (found.is_some())
+            return found;
+    }
+    return {};
+}
+
+} // namespace
+
+TEST_CASE("parallel find_map over 1e9 elements", "[benchmark]") {
+    ThreadPool pool;
+
+    for (double at : kHitAt) {
+        Probe probe{size_t(kElements * at)};
+        BENCHMARK(label("serial loop", at)) { return serial(probe); };
+        BENCHMARK(label("find_map_any", at)) {
+            return find_map_any(pool, 0, kElements, probe);
+        };
+        BENCHMARK(label("find_map_first", at)) {
+            return find_map_first(pool, 0, kElements, probe);
+        };
+    }
+
+    Probe miss{kElements};
+    BENCHMARK(label("serial loop", -1)) { return serial(miss); };
+    BENCHMARK(label("find_map_first", -1)) {
+        return find_map_first(pool, 0, kElements, miss);
+    };
+}
@@ -0,0 +1,212 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "exec/ThreadPool.hpp"
+#include "option/Option.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rustish::exec;
+using namespace rustish::option;
+
+namespace {
+
+const unsigned kFib = 25;
+// 1e8 in the original measurements; reduced so CI machines can hold it.
+const size_t kElements = 1u << 24;
+const size_t kGrain = 4096;
+const size_t kImbalancedTasks = 1u << 12;
+
+std::string label(const char *what, size_t n) {
+    return std::string(what) + " n=" + std::to_string(n);
+}
+
+// Same interface as ThreadPool, but every job goes through one locked
+// queue that all workers share.
+class SharedQueuePool {
+  public:
+    explicit SharedQueuePool(size_t threads) {
+        for (size_t i = 0; i < threads; ++i)
+            m_threads.emplace_back([this] { run(); });
+    }
+
+    ~SharedQueuePool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        for (std::thread &t : m_threads)
+            t.join();
+    }
+
+    template <typename F> void install(F f) {
+        if (on_worker()) {
+            f();
+            return;
+        }
+        detail::LatchJob<F> job(f);
+        push(&job);
+        job.wait();
+    }
+
+    template <typename A, typename B> void join(A a, B b) {
+        if (!on_worker()) {
+            install([&] { join(a, b); });
+            return;
+        }
+        detail::StackJob<B> job_b(b);
+        push(&job_b);
+        a();
+        while (!job_b.done.load(std::memory_order_acquire)) {
+            Option<Job *> job = try_pop_newest();
+            if (job.is_some())
+                job.unwrap()->execute();
+            else
+                std::this_thread::yield();
+        }
+    }
+
+    template <typename F>
+    void parallel_for(size_t begin, size_t end, size_t grain, F body) {
+        install([&] { split(begin, end, grain, body); });
+    }
+
+  private:
+    static bool &on_worker() {
+        static thread_local bool worker = false;
+        return worker;
+    }
+
+    template <typename F>
+    void split(size_t begin, size_t end, size_t grain, F &body) {
+        if (end - begin <= grain) {
+            body(begin, end);
+            return;
+        }
+        size_t mid = begin + (end - begin) / 2;
+        join([&] { split(begin, mid, grain, body); },
+             [&] { split(mid, end, grain, body); });
+    }
+
+    void push(Job *job) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_jobs.push_back(job);
+        }
+        m_cv.notify_one();
+    }
+
+    // Joiners help with the newest job, which keeps the nesting of helped
+    // jobs as shallow as plain recursion; idle workers take the oldest.
+    Option<Job *> try_pop_newest() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_jobs.empty())
+            return {};
+        Job *job = m_jobs.back();
+        m_jobs.pop_back();
+        return Option<Job *>(job);
+    }
+
+    void run() {
+        on_worker() = true;
+        for (;;) {
+            Job *job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+                if (m_jobs.empty())
+                    return;
+                job = m_jobs.front();
+                m_jobs.pop_front();
+            }
+            job->execute();
+        }
+    }
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Job *> m_jobs;
+    bool m_stop = false;
+};
+
+template <typename Pool> uint64_t fib(Pool &pool, unsigned n) {
+    if (n < 2)
+        return n;
+    uint64_t a = 0;
+    uint64_t b = 0;
+    pool.join([&] { a = fib(pool, n - 1); }, [&] { b = fib(pool, n - 2); });
+    return a + b;
+}
+
+template <typename Pool> uint64_t run_fib(Pool &pool) {
+    uint64_t ret = 0;
+    pool.install([&] { ret = fib(pool, kFib); });
+    return ret;
+}
+
+// Sum of the Some values in a nullable column.
+template <typename Pool>
+uint64_t sum_column(Pool &pool, const std::vector<Option<uint32_t>> &column) {
+    std::atomic<uint64_t> total{0};
+    pool.parallel_for(0, column.size(), kGrain, [&](size_t lo, size_t hi) {
+        uint64_t sum = 0;
+        for (size_t i = lo; i < hi; ++i)
+            if (column[i].is_some())
+                sum += column[i].as_ref().unwrap();
+        total += sum;
+    });
+    return total;
+}
+
+// Task i costs O(i), so a static split leaves the first workers idle.
+template <typename Pool> uint64_t imbalanced(Pool &pool) {
+    std::atomic<uint64_t> total{0};
+    pool.parallel_for(0, kImbalancedTasks, 1, [&](size_t lo, size_t hi) {
+        uint64_t x = 0;
+        for (size_t i = lo; i < hi; ++i)
+            for (size_t j = 0; j < i * 16; ++j)
+                x += (j * 0x9E3779B97F4A7C15ull) >> 60;
+        total += x;
+    });
+    return total;
+}
+
+} // namespace
+
+TEST_CASE("work-stealing pool against a shared queue", "[benchmark]") {
+    size_t threads = std::thread::hardware_concurrency();
+    ThreadPool stealing(threads);
+    SharedQueuePool shared(threads);
+
+    BENCHMARK(label("fib work-stealing", kFib)) { return run_fib(stealing); };
+    BENCHMARK(label("fib shared queue", kFib)) { return run_fib(shared); };
+
+    std::vector<Option<uint32_t>> column;
+    column.reserve(kElements);
+    for (size_t i = 0; i < kElements; ++i)
+        column.push_back(i % 7 ? Option<uint32_t>(uint32_t(i))
+                               : Option<uint32_t>());
+
+    BENCHMARK(label("parallel_for work-stealing", kElements)) {
+        return sum_column(stealing, column);
+    };
+    BENCHMARK(label("parallel_for shared queue", kElements)) {
+        return sum_column(shared, column);
+    };
+
+    BENCHMARK(label("imbalanced work-stealing", kImbalancedTasks)) {
+        return imbalanced(stealing);
+    };
+    BENCHMARK(label("imbalanced shared queue", kImbalancedTasks)) {
+        return imbalanced(shared);
+    };
+}
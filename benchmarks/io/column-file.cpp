@@ -0,0 +1,132 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "codec/Decoder.hpp"
+#include "codec/Encoder.hpp"
+#include "io/ColumnFile.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace rustish::codec;
+using namespace rustish::io;
+using namespace rustish::option;
+
+namespace {
+
+// Raise for bigger than RAM runs; kept small enough for CI machines.
+const size_t kSizes[] = {1u << 16, 1u << 22};
+
+std::string label(const char *what, size_t n) {
+    return std::string(what) + " n=" + std::to_string(n);
+}
+
+Option<uint64_t> value_at(size_t i) {
+    uint64_t x = i * 0x9E3779B97F4A7C15ull;
+    if ((x >> 60) < 2)
+        return {};
+    return Option<uint64_t>(x >> 20);
+}
+
+// Drops the file's clean pages from the page cache so the next open has to
+// go to disk. Advisory: on some filesystems this is a no-op.
+void evict(const std::string &path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+    ::fdatasync(fd);
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+}
+
+std::vector<uint8_t> read_file(const std::string &path) {
+    std::vector<uint8_t> bytes;
+    FILE *f = std::fopen(path.c_str(), "rb");
+    if (!f)
+        return bytes;
+    std::fseek(f, 0, SEEK_END);
+    bytes.resize(static_cast<size_t>(std::ftell(f)));
+    std::fseek(f, 0, SEEK_SET);
+    size_t got = std::fread(bytes.data(), 1, bytes.size(), f);
+    bytes.resize(got);
+    std::fclose(f);
+    return bytes;
+}
+
+uint64_t scan_mapped(const std::string &path) {
+    MappedColumn<uint64_t> column =
+        MappedColumn<uint64_t>::open(path).unwrap();
+    uint64_t sum = 0;
+    for (size_t i = 0; i < column.len(); ++i) {
+        Option<const uint64_t &> v = column.get(i);
+        if (v.is_some())
+            sum += v.unwrap();
+    }
+    return sum;
+}
+
+// The alternative: read the encoded file, decode it into a vector of
+// Options, then scan that.
+uint64_t parse_and_scan(const std::string &path, size_t n) {
+    std::vector<uint8_t> bytes = read_file(path);
+    std::vector<Option<uint64_t>> column(n);
+    Decoder dec(bytes.data(), bytes.size());
+    dec.read_option_column(column.data(), n);
+    uint64_t sum = 0;
+    for (Option<uint64_t> &v : column)
+        if (v.is_some())
+            sum += v.unwrap();
+    return sum;
+}
+
+} // namespace
+
+TEST_CASE("column file open and scan", "[benchmark]") {
+    std::string mapped_path =
+        "/tmp/rustish-bench-column-" + std::to_string(::getpid());
+    std::string encoded_path = mapped_path + ".enc";
+
+    for (size_t n : kSizes) {
+        {
+            ColumnWriter<uint64_t> writer =
+                ColumnWriter<uint64_t>::create(mapped_path).unwrap();
+            std::vector<Option<uint64_t>> column;
+            column.reserve(n);
+            for (size_t i = 0; i < n; ++i) {
+                writer.push(value_at(i));
+                column.push_back(value_at(i));
+            }
+
+            std::vector<uint8_t> buf(n * max_varint_len + n / 8 + 16);
+            Encoder enc(buf.data(), buf.size());
+            enc.write_option_column(column.data(), n);
+            FILE *f = std::fopen(encoded_path.c_str(), "wb");
+            std::fwrite(buf.data(), 1, enc.len(), f);
+            std::fclose(f);
+        }
+
+        // Cold runs evict inside the timed region; dropping clean pages is
+        // cheap next to re-reading them.
+        BENCHMARK(label("mmap cold", n)) {
+            evict(mapped_path);
+            return scan_mapped(mapped_path);
+        };
+        BENCHMARK(label("mmap warm", n)) { return scan_mapped(mapped_path); };
+
+        BENCHMARK(label("parse and rebuild cold", n)) {
+            evict(encoded_path);
+            return parse_and_scan(encoded_path, n);
+        };
+        BENCHMARK(label("parse and rebuild warm", n)) {
+            return parse_and_scan(encoded_path, n);
+        };
+    }
+
+    std::remove(mapped_path.c_str());
+    std::remove(encoded_path.c_str());
+}
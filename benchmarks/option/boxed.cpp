@@ -0,0 +1,100 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/Boxed.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace rustish::option;
+
+namespace {
+
+// Diagnostic data attached to a small fraction of requests.
+struct DebugBlock {
+    uint64_t trace_id = 0;
+    char notes[2048] = {};
+};
+
+struct BoxedDebugBlock : DebugBlock {};
+
+} // namespace
+
+namespace rustish {
+namespace option {
+template <> struct BoxedPayload<BoxedDebugBlock> : BoxedIn<> {};
+} // namespace option
+} // namespace rustish
+
+namespace {
+
+const size_t kRequests = 1u << 15;
+
+template <typename Debug> struct Request {
+    uint64_t id;
+    uint32_t route;
+    uint32_t bytes;
+    Option<Debug> debug;
+};
+
+// Roughly one request in 128 carries a debug block.
+template <typename Debug> Request<Debug> make_request(uint64_t &state) {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    Request<Debug> req{state >> 20, static_cast<uint32_t>(state >> 56),
+                       static_cast<uint32_t>(state >> 40) & 0xfff, None()};
+    if ((state >> 33) % 128 == 0) {
+        Debug debug;
+        debug.trace_id = state;
+        req.debug = std::move(debug);
+    }
+    return req;
+}
+
+template <typename Debug> uint64_t process(const Request<Debug> &req) {
+    uint64_t cost = req.id ^ (uint64_t(req.route) << 32) ^ req.bytes;
+    if (req.debug.is_some())
+        cost += req.debug.as_ref().unwrap_unchecked().trace_id;
+    return cost;
+}
+
+template <typename Debug> std::string label(const std::string &what) {
+    return what + " sizeof(Request)=" +
+           std::to_string(sizeof(Request<Debug>));
+}
+
+template <typename Debug> void bench_requests(const char *storage) {
+    std::vector<Request<Debug>> requests;
+    requests.reserve(kRequests);
+    uint64_t state = 1;
+    for (size_t i = 0; i < kRequests; ++i)
+        requests.push_back(make_request<Debug>(state));
+
+    BENCHMARK(label<Debug>(std::string(storage) + " scan")) {
+        uint64_t sum = 0;
+        for (const Request<Debug> &req : requests)
+            sum += process(req);
+        return sum;
+    };
+
+    // Requests arrive, are handled and dropped, as in a server loop.
+    BENCHMARK(label<Debug>(std::string(storage) + " handle")) {
+        uint64_t state = requests.size(), sum = 0;
+        for (size_t i = 0; i < kRequests; ++i) {
+            Request<Debug> req = make_request<Debug>(state);
+            sum += process(req);
+        }
+        return sum;
+    };
+}
+
+} // namespace
+
+TEST_CASE("Requests with rarely present large payloads", "[benchmark]") {
+    WARN("sizeof(Option<DebugBlock>): inline "
+         << sizeof(Option<DebugBlock>) << ", boxed "
+         << sizeof(Option<BoxedDebugBlock>));
+
+    bench_requests<DebugBlock>("inline");
+    bench_requests<BoxedDebugBlock>("boxed");
+}
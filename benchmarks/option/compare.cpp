@@ -0,0 +1,116 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "collections/HashMap.hpp"
+#include "option/Option.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace rustish::collections;
+using namespace rustish::option;
+
+namespace {
+
+const size_t kSortSize = 10000000;
+const size_t kKeys = 1u << 20;
+
+// What callers wrote before Option had comparisons: a lambda that checks
+// presence on each side before looking at the values.
+struct BranchyLess {
+    bool operator()(const Option<int> &a, const Option<int> &b) const {
+        if (a.is_none())
+            return b.is_some();
+        if (b.is_none())
+            return false;
+        return a.as_ref().unwrap() < b.as_ref().unwrap();
+    }
+};
+
+struct BranchyHash {
+    size_t operator()(const Option<int> &key) const {
+        if (key.is_none())
+            return 0;
+        return std::hash<int>()(key.as_ref().unwrap()) + 1;
+    }
+};
+
+struct BranchyEq {
+    bool operator()(const Option<int> &a, const Option<int> &b) const {
+        if (a.is_none() || b.is_none())
+            return a.is_none() == b.is_none();
+        return a.as_ref().unwrap() == b.as_ref().unwrap();
+    }
+};
+
+// Half None, half random values, so presence is unpredictable.
+std::vector<Option<int>> random_options(size_t n) {
+    std::vector<Option<int>> values(n);
+    uint64_t state = 3;
+    for (auto &value : values) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        if ((state >> 63) == 0)
+            value = static_cast<int>(state >> 32);
+    }
+    return values;
+}
+
+std::string label(const char *what, size_t n) {
+    return std::string(what) + " n=" + std::to_string(n);
+}
+
+} // namespace
+
+TEST_CASE("Sort Option<int> with operator< and a branching comparator",
+          "[benchmark]") {
+    std::vector<Option<int>> values = random_options(kSortSize);
+
+    BENCHMARK_ADVANCED(label("std::sort operator<", kSortSize))
+    (Catch::Benchmark::Chronometer meter) {
+        std::vector<Option<int>> copy = values;
+        meter.measure([&] {
+            copy = values;
+            std::sort(copy.begin(), copy.end());
+            return copy.size();
+        });
+    };
+
+    BENCHMARK_ADVANCED(label("std::sort branching lambda", kSortSize))
+    (Catch::Benchmark::Chronometer meter) {
+        std::vector<Option<int>> copy = values;
+        meter.measure([&] {
+            copy = values;
+            std::sort(copy.begin(), copy.end(), BranchyLess());
+            return copy.size();
+        });
+    };
+}
+
+TEST_CASE("HashMap keyed by Option<int> with std::hash and a branching hash",
+          "[benchmark]") {
+    std::vector<Option<int>> keys = random_options(kKeys);
+
+    HashMap<Option<int>, int> std_map;
+    HashMap<Option<int>, int, BranchyHash, BranchyEq> branchy_map;
+    for (const Option<int> &key : keys) {
+        std_map.insert(key, 1);
+        branchy_map.insert(key, 1);
+    }
+
+    BENCHMARK(label("std::hash<Option<int>> lookup", kKeys)) {
+        int sum = 0;
+        for (const Option<int> &key : keys)
+            sum += std_map.get(key).is_some();
+        return sum;
+    };
+
+    BENCHMARK(label("branching hash lookup", kKeys)) {
+        int sum = 0;
+        for (const Option<int> &key : keys)
+            sum += branchy_map.get(key).is_some();
+        return sum;
+    };
+}
@@ -0,0 +1,66 @@
+// Compile-time benchmark: instantiates the constrained Option members for a
+// few hundred distinct payload types. It is built as its own object library
+// rather than run, so time the build of the target instead, e.g.
+//   cmake -B build -DCMAKE_CXX_STANDARD=20
+//   time cmake --build build --target option-compile-time
+// and compare against a build with -DCMAKE_CXX_STANDARD=14, which checks the
+// same constraints with enable_if.
+
+#include "option/Option.hpp"
+
+#include <string>
+
+using namespace rustish::option;
+
+namespace {
+
+template <int N> struct Payload {
+    Payload() {}
+    Payload(int v) : value(v) {}
+    Payload(const char *s) : value(s[0]) {}
+
+    int value = N;
+};
+
+template <int N> int exercise() {
+    using P = Payload<N>;
+
+    Option<P> a = N;
+    Option<P> b = "x";
+    Option<P> c;
+    c = N + 1;
+    c.insert("y");
+    c.get_or_insert(N);
+    Option<P> d = c.replace(P(N));
+
+    Option<std::string> s = "abc";
+    s.insert("de");
+
+    const P &ref = a.insert(N);
+    Option<const P &> r = ref;
+    Option<const P &> none;
+    const P &fallback = none.unwrap_or(ref);
+
+    return b.unwrap_or(N).value + d.unwrap_or(P()).value +
+           r.unwrap_or(ref).value + fallback.value +
+           static_cast<int>(s.unwrap_or("").size());
+}
+
+template <int... Ns> struct Seq {};
+
+template <int N, int... Ns> struct MakeSeq : MakeSeq<N - 1, N - 1, Ns...> {};
+
+template <int... Ns> struct MakeSeq<0, Ns...> { using type = Seq<Ns...>; };
+
+template <int... Ns> int exercise_all(Seq<Ns...>) {
+    int sum = 0;
+    int each[] = {(sum += exercise<Ns>())...};
+    (void)each;
+    return sum;
+}
+
+} // namespace
+
+int option_compile_time_benchmark() {
+    return exercise_all(MakeSeq<256>::type());
+}
@@ -0,0 +1,82 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/Option.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace rustish::option;
+
+namespace {
+
+const size_t kLookups = 1u << 20;
+const size_t kTable = 1u << 12;
+const unsigned kSomePercent[] = {99, 50, 1};
+
+std::string label(const char *what, unsigned some_percent) {
+    return std::string(what) + " some=" + std::to_string(some_percent) + "%";
+}
+
+// Cold fallback with enough code that its placement matters.
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((noinline))
+#endif
+uint64_t recompute(size_t i) {
+    uint64_t x = i;
+    for (int r = 0; r < 8; ++r)
+        x = (x ^ (x >> 31)) * 0x9E3779B97F4A7C15ull;
+    return x;
+}
+
+std::vector<Option<uint64_t>> make_table(unsigned some_percent) {
+    std::vector<Option<uint64_t>> table(kTable);
+    uint64_t state = 7;
+    for (size_t i = 0; i < kTable; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        if ((state >> 33) % 100 < some_percent)
+            table[i] = Option<uint64_t>(state >> 40);
+    }
+    return table;
+}
+
+// Cache lookups: the Option is copied out of the table and unwrapped with a
+// recomputing fallback.
+template <typename Unwrap>
+uint64_t lookups(const std::vector<Option<uint64_t>> &table, Unwrap unwrap) {
+    uint64_t sum = 0;
+    size_t idx = 1;
+    for (size_t i = 0; i < kLookups; ++i) {
+        idx = (idx * 5 + 1) & (kTable - 1);
+        Option<uint64_t> hit = table[idx];
+        sum += unwrap(hit, idx);
+    }
+    return sum;
+}
+
+} // namespace
+
+TEST_CASE("likely_some and likely_none branch layout", "[benchmark]") {
+    for (unsigned some_percent : kSomePercent) {
+        std::vector<Option<uint64_t>> table = make_table(some_percent);
+
+        BENCHMARK(label("no hint", some_percent)) {
+            return lookups(table, [](Option<uint64_t> &hit, size_t idx) {
+                return hit.unwrap_or_else([&] { return recompute(idx); });
+            });
+        };
+        BENCHMARK(label("likely_some", some_percent)) {
+            return lookups(table, [](Option<uint64_t> &hit, size_t idx) {
+                return hit.likely_some().unwrap_or_else(
+                    [&] { return recompute(idx); });
+            });
+        };
+        BENCHMARK(label("likely_none", some_percent)) {
+            return lookups(table, [](Option<uint64_t> &hit, size_t idx) {
+                return hit.likely_none().unwrap_or_else(
+                    [&] { return recompute(idx); });
+            });
+        };
+    }
+}
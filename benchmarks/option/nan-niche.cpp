@@ -0,0 +1,79 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/NanNiche.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace rustish::option;
+
+namespace {
+
+const size_t kSizes[] = {1u << 12, 1u << 18, 1u << 22};
+
+std::string label(const char *what, size_t n) {
+    return std::string(what) + " n=" + std::to_string(n);
+}
+
+} // namespace
+
+TEST_CASE("Nullable double column scan", "[benchmark]") {
+    for (size_t n : kSizes) {
+        std::vector<Option<double>> tagged;
+        std::vector<Option<NanNiche<double>>> niche;
+        tagged.reserve(n);
+        niche.reserve(n);
+
+        // Roughly one in ten values is missing.
+        uint64_t state = 1;
+        for (size_t i = 0; i < n; ++i) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            if ((state >> 40) % 10 == 0) {
+                tagged.push_back(None());
+                niche.push_back(None());
+            } else {
+                double v = static_cast<double>(state >> 44);
+                tagged.push_back(v);
+                niche.push_back(NanNiche<double>(v));
+            }
+        }
+
+        WARN(label("bytes", n)
+             << ": tagged " << n * sizeof(Option<double>) << ", NanNiche "
+             << n * sizeof(Option<NanNiche<double>>));
+
+        BENCHMARK(label("tagged sum", n)) {
+            double sum = 0;
+            for (const Option<double> &v : tagged)
+                if (v.is_some())
+                    sum += v.as_ref().unwrap();
+            return sum;
+        };
+
+        BENCHMARK(label("NanNiche sum", n)) {
+            double sum = 0;
+            for (const Option<NanNiche<double>> &v : niche)
+                if (v.is_some())
+                    sum += v.as_ref().unwrap();
+            return sum;
+        };
+
+        // The column is a plain array of doubles, so the presence test can
+        // be done on the loaded value with a select instead of a branch.
+        BENCHMARK(label("NanNiche branchless sum", n)) {
+            double sum = 0;
+            const uint64_t none = NanBits<double>::none;
+            for (const Option<NanNiche<double>> &v : niche) {
+                uint64_t bits;
+                double value;
+                std::memcpy(&bits, &v, sizeof(bits));
+                std::memcpy(&value, &v, sizeof(value));
+                sum += bits == none ? 0.0 : value;
+            }
+            return sum;
+        };
+    }
+}
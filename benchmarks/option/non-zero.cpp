@@ -0,0 +1,89 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "collections/HashMap.hpp"
+#include "option/NonZero.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace rustish::collections;
+using namespace rustish::option;
+
+namespace {
+
+const size_t kSizes[] = {1u << 12, 1u << 16, 1u << 20};
+
+// Hash and equality for Option keys, with None hashing to zero.
+struct OptionHash {
+    template <typename T> size_t operator()(const Option<T> &key) const {
+        if (key.is_none())
+            return 0;
+        return std::hash<uint64_t>()(key.as_ref().unwrap());
+    }
+};
+
+struct OptionEq {
+    template <typename T>
+    bool operator()(const Option<T> &a, const Option<T> &b) const {
+        if (a.is_none() || b.is_none())
+            return a.is_none() == b.is_none();
+        return static_cast<uint64_t>(a.as_ref().unwrap()) ==
+               static_cast<uint64_t>(b.as_ref().unwrap());
+    }
+};
+
+std::string label(const char *what, size_t n) {
+    return std::string(what) + " n=" + std::to_string(n);
+}
+
+} // namespace
+
+TEST_CASE("HashMap keyed by Option<uint64_t> against Option<NonZeroU64>",
+          "[benchmark]") {
+    for (size_t n : kSizes) {
+        std::vector<uint64_t> ids(n);
+        uint64_t state = 1;
+        for (auto &id : ids) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            id = state | 1;
+        }
+
+        HashMap<Option<uint64_t>, uint64_t, OptionHash, OptionEq> tagged;
+        HashMap<Option<NonZeroU64>, uint64_t, OptionHash, OptionEq> niche;
+        for (uint64_t id : ids) {
+            tagged.insert(Option<uint64_t>(id), id);
+            niche.insert(Option<NonZeroU64>(NonZeroU64(id)), id);
+        }
+
+        BENCHMARK(label("Option<uint64_t> key insert", n)) {
+            HashMap<Option<uint64_t>, uint64_t, OptionHash, OptionEq> map;
+            for (uint64_t id : ids)
+                map.insert(Option<uint64_t>(id), id);
+            return map.len();
+        };
+
+        BENCHMARK(label("Option<NonZeroU64> key insert", n)) {
+            HashMap<Option<NonZeroU64>, uint64_t, OptionHash, OptionEq> map;
+            for (uint64_t id : ids)
+                map.insert(Option<NonZeroU64>(NonZeroU64(id)), id);
+            return map.len();
+        };
+
+        BENCHMARK(label("Option<uint64_t> key lookup", n)) {
+            uint64_t sum = 0;
+            for (uint64_t id : ids)
+                sum += tagged.get(Option<uint64_t>(id)).unwrap_unchecked();
+            return sum;
+        };
+
+        BENCHMARK(label("Option<NonZeroU64> key lookup", n)) {
+            uint64_t sum = 0;
+            for (uint64_t id : ids)
+                sum += niche.get(Option<NonZeroU64>(NonZeroU64(id)))
+                           .unwrap_unchecked();
+            return sum;
+        };
+    }
+}
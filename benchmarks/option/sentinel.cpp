@@ -0,0 +1,88 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/Sentinel.hpp"
+
+#include <cstdint>
+#include <vector>
+
+using namespace rustish::option;
+
+namespace {
+
+// 1M vertices with 16 random out-edges each (16M edges). The 100M edge
+// graph only needs kVertices raised; it is left out of the default run
+// because building it alone takes most of a minute.
+const uint32_t kVertices = 1u << 20;
+const uint32_t kDegree = 16;
+
+struct Csr {
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> targets;
+};
+
+Csr random_graph(uint32_t vertices, uint32_t degree) {
+    Csr g;
+    g.offsets.reserve(vertices + 1);
+    g.targets.reserve(static_cast<size_t>(vertices) * degree);
+    uint64_t state = 42;
+    for (uint32_t v = 0; v < vertices; ++v) {
+        g.offsets.push_back(static_cast<uint32_t>(g.targets.size()));
+        for (uint32_t e = 0; e < degree; ++e) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            g.targets.push_back(static_cast<uint32_t>((state >> 32) %
+                                                      vertices));
+        }
+    }
+    g.offsets.push_back(static_cast<uint32_t>(g.targets.size()));
+    return g;
+}
+
+// Breadth first search recording each vertex's parent; returns the number
+// of vertices reached.
+template <typename Parent, typename Make>
+size_t bfs(const Csr &g, uint32_t root, std::vector<Option<Parent>> &parents,
+           Make make) {
+    std::fill(parents.begin(), parents.end(), Option<Parent>());
+    std::vector<uint32_t> frontier{root}, next;
+    parents[root] = make(root);
+    size_t reached = 1;
+
+    while (!frontier.empty()) {
+        next.clear();
+        for (uint32_t v : frontier) {
+            for (uint32_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+                uint32_t w = g.targets[e];
+                if (parents[w].is_none()) {
+                    parents[w] = make(v);
+                    next.push_back(w);
+                    ++reached;
+                }
+            }
+        }
+        frontier.swap(next);
+    }
+    return reached;
+}
+
+} // namespace
+
+TEST_CASE("BFS parent array: Option<uint32_t> against Option<Index32>",
+          "[benchmark]") {
+    Csr g = random_graph(kVertices, kDegree);
+
+    std::vector<Option<uint32_t>> tagged(kVertices);
+    std::vector<Option<Index32>> sentinel(kVertices);
+    WARN("parent array bytes: tagged " << tagged.size() * sizeof(tagged[0])
+                                       << ", Index32 "
+                                       << sentinel.size() * sizeof(sentinel[0]));
+
+    BENCHMARK("BFS Option<uint32_t>") {
+        return bfs(g, 0, tagged, [](uint32_t v) { return Option<uint32_t>(v); });
+    };
+
+    BENCHMARK("BFS Option<Index32>") {
+        return bfs(g, 0, sentinel,
+                   [](uint32_t v) { return Option<Index32>(Index32(v)); });
+    };
+}
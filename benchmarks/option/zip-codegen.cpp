@@ -0,0 +1,44 @@
+// Codegen check for zip and with_all: built as its own object library and
+// not run. Disassemble it, e.g.
+//   cmake --build build --target option-zip-codegen
+//   objdump -d --no-show-raw-insn -C $(find build -name 'zip-codegen*.o')
+// With optimisations the tagged Options below OR their tags together and
+// test presence with one branch, and the niche Options compare payloads
+// with the marker without a separate tag.
+
+#include "option/NonZero.hpp"
+#include "option/Zip.hpp"
+
+#include <cstdint>
+#include <tuple>
+
+using namespace rustish::option;
+
+uint64_t zip_codegen_tagged(Option<uint64_t> &a, Option<uint64_t> &b,
+                            Option<uint64_t> &c, Option<uint64_t> &d) {
+    return with_all(a, b, c, d,
+                    [](uint64_t a, uint64_t b, uint64_t c, uint64_t d) {
+                        return a + b + c + d;
+                    })
+        .unwrap_or(0);
+}
+
+uint64_t zip_codegen_niche(Option<NonZeroU64> &a, Option<NonZeroU64> &b,
+                           Option<NonZeroU64> &c, Option<NonZeroU64> &d) {
+    return with_all(a, b, c, d,
+                    [](NonZeroU64 a, NonZeroU64 b, NonZeroU64 c,
+                       NonZeroU64 d) {
+                        return a.get() + b.get() + c.get() + d.get();
+                    })
+        .unwrap_or(0);
+}
+
+bool zip_codegen_all_some(const Option<uint32_t> &a, const Option<uint32_t> &b,
+                          const Option<uint32_t> &c) {
+    return all_some(a, b, c);
+}
+
+Option<std::tuple<uint32_t, uint32_t>> zip_codegen_zip(Option<uint32_t> &a,
+                                                      Option<uint32_t> &b) {
+    return zip(a, b);
+}
@@ -0,0 +1,94 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/NonZero.hpp"
+#include "option/Zip.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace rustish::option;
+
+namespace {
+
+const size_t kRecords = 1u << 20;
+const unsigned kAllSomePercent[] = {99, 50};
+
+template <typename T> struct Record {
+    Option<T> a, b, c, d;
+};
+
+template <typename T> T make_value(uint64_t v) { return T(v | 1); }
+
+// Each field is present with the probability that makes all four present
+// some_percent of the time.
+template <typename T>
+std::vector<Record<T>> make_records(unsigned all_some_percent) {
+    std::vector<Record<T>> records(kRecords);
+    uint64_t state = 11;
+    auto next = [&] {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return state >> 33;
+    };
+    for (auto &r : records) {
+        bool all = next() % 100 < all_some_percent;
+        unsigned missing = all ? 4 : next() % 4;
+        Option<T> *fields[] = {&r.a, &r.b, &r.c, &r.d};
+        for (unsigned i = 0; i < 4; ++i)
+            if (i != missing)
+                *fields[i] = Option<T>(make_value<T>(next()));
+    }
+    return records;
+}
+
+template <typename T> uint64_t sum_short_circuit(std::vector<Record<T>> &rs) {
+    uint64_t sum = 0;
+    for (auto &r : rs) {
+        if (r.a.is_some() && r.b.is_some() && r.c.is_some() && r.d.is_some())
+            sum += uint64_t(r.a.unwrap_unchecked()) +
+                   uint64_t(r.b.unwrap_unchecked()) +
+                   uint64_t(r.c.unwrap_unchecked()) +
+                   uint64_t(r.d.unwrap_unchecked());
+    }
+    return sum;
+}
+
+template <typename T> uint64_t sum_with_all(std::vector<Record<T>> &rs) {
+    uint64_t sum = 0;
+    for (auto &r : rs) {
+        with_all(r.a, r.b, r.c, r.d, [&](T a, T b, T c, T d) {
+            sum += uint64_t(a) + uint64_t(b) + uint64_t(c) + uint64_t(d);
+        });
+    }
+    return sum;
+}
+
+template <typename T>
+void bench(const char *name, const std::vector<Record<T>> &records,
+           unsigned percent) {
+    std::string suffix = std::string(" ") + name +
+                         " all_some=" + std::to_string(percent) + "%";
+
+    BENCHMARK_ADVANCED("&& chain" + suffix)
+    (Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<Record<T>>> copies(meter.runs(), records);
+        meter.measure([&](int i) { return sum_short_circuit(copies[i]); });
+    };
+
+    BENCHMARK_ADVANCED("with_all" + suffix)
+    (Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<Record<T>>> copies(meter.runs(), records);
+        meter.measure([&](int i) { return sum_with_all(copies[i]); });
+    };
+}
+
+} // namespace
+
+TEST_CASE("with_all against a chain of is_some checks", "[benchmark]") {
+    for (unsigned percent : kAllSomePercent) {
+        bench("Option<uint64_t>", make_records<uint64_t>(percent), percent);
+        bench("Option<NonZeroU64>", make_records<NonZeroU64>(percent),
+              percent);
+    }
+}
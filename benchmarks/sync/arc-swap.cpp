@@ -0,0 +1,135 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "sync/ArcSwap.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rustish::boxed;
+using namespace rustish::option;
+using namespace rustish::sync;
+
+namespace {
+
+const size_t kThreads[] = {1, 2, 4, 8};
+const size_t kReads = 1u << 18;
+
+struct Routes {
+    explicit Routes(uint64_t v) : version(v) {}
+
+    uint64_t version;
+    uint64_t table[7] = {};
+};
+
+#if __cplusplus >= 201703L
+using SharedMutex = std::shared_mutex;
+#else
+using SharedMutex = std::shared_timed_mutex;
+#endif
+
+// Runs threads readers, each doing kReads reads, while a writer publishes
+// a new version every 100us until they finish.
+template <typename Read, typename Write>
+uint64_t run(size_t threads, Read read, Write write) {
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> sum{0};
+    std::thread writer([&] {
+        for (uint64_t v = 2; !done.load(std::memory_order_relaxed); ++v) {
+            write(v);
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    });
+
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < threads; ++t) {
+        readers.emplace_back([&] {
+            uint64_t local = 0;
+            for (size_t i = 0; i < kReads; ++i)
+                local += read();
+            sum.fetch_add(local, std::memory_order_relaxed);
+        });
+    }
+    for (std::thread &t : readers)
+        t.join();
+    done.store(true, std::memory_order_relaxed);
+    writer.join();
+    return sum.load();
+}
+
+std::string label(const char *what, size_t threads) {
+    return std::string(what) + " readers=" + std::to_string(threads);
+}
+
+} // namespace
+
+TEST_CASE("Snapshot reads under reader scaling", "[benchmark]") {
+    for (size_t threads : kThreads) {
+        BENCHMARK(label("ArcSwapOption load", threads)) {
+            ArcSwapOption<Routes> routes(Arc<Routes>::new_(1));
+            return run(
+                threads,
+                [&] {
+                    ArcSwapOption<Routes>::Snapshot snap = routes.load();
+                    return snap.as_ref().unwrap_unchecked().version;
+                },
+                [&](uint64_t v) { routes.store(Arc<Routes>::new_(v)); });
+        };
+
+        BENCHMARK(label("ArcSwapOption load_full", threads)) {
+            ArcSwapOption<Routes> routes(Arc<Routes>::new_(1));
+            return run(
+                threads,
+                [&] {
+                    Option<Arc<Routes>> full = routes.load_full();
+                    return full.unwrap_unchecked()->version;
+                },
+                [&](uint64_t v) { routes.store(Arc<Routes>::new_(v)); });
+        };
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+        BENCHMARK(label("std::atomic<std::shared_ptr>", threads)) {
+            std::atomic<std::shared_ptr<const Routes>> routes(
+                std::make_shared<const Routes>(1));
+            return run(
+                threads, [&] { return routes.load()->version; },
+                [&](uint64_t v) {
+                    routes.store(std::make_shared<const Routes>(v));
+                });
+        };
+#else
+        BENCHMARK(label("std::atomic_load(std::shared_ptr)", threads)) {
+            std::shared_ptr<const Routes> routes =
+                std::make_shared<const Routes>(1);
+            return run(
+                threads, [&] { return std::atomic_load(&routes)->version; },
+                [&](uint64_t v) {
+                    std::atomic_store(&routes,
+                                      std::make_shared<const Routes>(v));
+                });
+        };
+#endif
+
+        BENCHMARK(label("shared_mutex", threads)) {
+            SharedMutex lock;
+            Routes routes(1);
+            return run(
+                threads,
+                [&] {
+                    std::shared_lock<SharedMutex> guard(lock);
+                    return routes.version;
+                },
+                [&](uint64_t v) {
+                    std::lock_guard<SharedMutex> guard(lock);
+                    routes = Routes(v);
+                });
+        };
+    }
+}
@@ -0,0 +1,116 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "sync/MpmcQueue.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rustish::option;
+using namespace rustish::sync;
+
+namespace {
+
+const size_t kMessages = 1u << 20;
+const size_t kCapacity = 1024;
+const int kThreads[] = {1, 2, 4, 8, 16, 32, 64};
+
+std::string label(const char *what, int threads) {
+    return std::string(what) + " producers=consumers=" +
+           std::to_string(threads) + " n=" + std::to_string(kMessages);
+}
+
+// Bounded queue guarded by one mutex and two condition variables.
+template <typename T> class MutexQueue {
+  public:
+    explicit MutexQueue(size_t capacity) : m_capacity(capacity) {}
+
+    void close() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+        m_not_empty.notify_all();
+        m_not_full.notify_all();
+    }
+
+    Option<T> push(T value) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_not_full.wait(
+            lock, [&] { return m_closed || m_items.size() < m_capacity; });
+        if (m_closed)
+            return Option<T>(std::move(value));
+        m_items.push_back(std::move(value));
+        m_not_empty.notify_one();
+        return {};
+    }
+
+    Option<T> pop() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_not_empty.wait(lock, [&] { return m_closed || !m_items.empty(); });
+        if (m_items.empty())
+            return {};
+        Option<T> ret(std::move(m_items.front()));
+        m_items.pop_front();
+        m_not_full.notify_one();
+        return ret;
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_not_empty;
+    std::condition_variable m_not_full;
+    std::deque<T> m_items;
+    size_t m_capacity;
+    bool m_closed = false;
+};
+
+// threads producers split kMessages between them; threads consumers drain
+// until the queue is closed.
+template <typename Q> uint64_t run(int threads) {
+    Q q(kCapacity);
+    std::vector<std::thread> consumers;
+    std::vector<uint64_t> sums(threads);
+    for (int c = 0; c < threads; ++c)
+        consumers.emplace_back([&, c] {
+            for (;;) {
+                Option<uint64_t> v = q.pop();
+                if (v.is_none())
+                    return;
+                sums[c] += v.unwrap();
+            }
+        });
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < threads; ++p)
+        producers.emplace_back([&, p] {
+            for (uint64_t i = p; i < kMessages; i += threads)
+                q.push(i);
+        });
+    for (std::thread &t : producers)
+        t.join();
+    q.close();
+    for (std::thread &t : consumers)
+        t.join();
+
+    uint64_t sum = 0;
+    for (uint64_t s : sums)
+        sum += s;
+    return sum;
+}
+
+} // namespace
+
+TEST_CASE("MPMC queue scaling", "[benchmark]") {
+    for (int threads : kThreads) {
+        BENCHMARK(label("MpmcQueue", threads)) {
+            return run<MpmcQueue<uint64_t>>(threads);
+        };
+        BENCHMARK(label("mutex+deque", threads)) {
+            return run<MutexQueue<uint64_t>>(threads);
+        };
+    }
+}
@@ -0,0 +1,58 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "sync/PerThread.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rustish::option;
+using namespace rustish::sync;
+
+namespace {
+
+const size_t kThreads = 64;
+const size_t kWrites = 1u << 16;
+
+// Each thread repeatedly updates its own slot. The signal fence keeps the
+// compiler from collapsing the loop into a single store.
+template <typename Slots> uint64_t hammer(Slots &slots) {
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&slots, t] {
+            Option<uint64_t> &slot = slots[t];
+            for (uint64_t i = 0; i < kWrites; ++i) {
+                slot = Option<uint64_t>(slot.unwrap_or(0) + i);
+                std::atomic_signal_fence(std::memory_order_seq_cst);
+            }
+        });
+    }
+    for (std::thread &t : threads)
+        t.join();
+
+    uint64_t sum = 0;
+    for (size_t t = 0; t < kThreads; ++t)
+        sum += slots[t].unwrap_or(0);
+    return sum;
+}
+
+std::string label(const char *what) {
+    return std::string(what) + " threads=" + std::to_string(kThreads);
+}
+
+} // namespace
+
+TEST_CASE("Per-thread Option slots, padded against adjacent", "[benchmark]") {
+    BENCHMARK(label("adjacent Option<uint64_t> slots")) {
+        std::vector<Option<uint64_t>> slots(kThreads);
+        return hammer(slots);
+    };
+
+    BENCHMARK(label("PerThread<Option<uint64_t>> slots")) {
+        PerThread<Option<uint64_t>> slots(kThreads);
+        return hammer(slots);
+    };
+}
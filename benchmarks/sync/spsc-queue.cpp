@@ -0,0 +1,120 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "sync/SpscQueue.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace rustish::option;
+using namespace rustish::sync;
+
+namespace {
+
+const size_t kMessages = 1u << 22;
+const size_t kRoundTrips = 1u << 16;
+const size_t kCapacity = 1024;
+
+std::string label(const char *what, size_t n) {
+    return std::string(what) + " n=" + std::to_string(n);
+}
+
+// The queue the pipeline uses today.
+template <typename T> class MutexQueue {
+  public:
+    explicit MutexQueue(size_t capacity) : m_capacity(capacity) {}
+
+    Option<T> try_push(T value) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_items.size() == m_capacity)
+            return Option<T>(std::move(value));
+        m_items.push_back(std::move(value));
+        return {};
+    }
+
+    Option<T> try_pop() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_items.empty())
+            return {};
+        Option<T> ret(std::move(m_items.front()));
+        m_items.pop_front();
+        return ret;
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::deque<T> m_items;
+    size_t m_capacity;
+};
+
+// Spinners yield so the benchmark also makes progress when both threads
+// share a core.
+template <typename Q> void push_spin(Q &q, uint64_t value) {
+    Option<uint64_t> v = Option<uint64_t>(value);
+    while ((v = q.try_push(v.unwrap())).is_some())
+        std::this_thread::yield();
+}
+
+template <typename Q> uint64_t pop_spin(Q &q) {
+    for (;;) {
+        Option<uint64_t> v = q.try_pop();
+        if (v.is_some())
+            return v.unwrap();
+        std::this_thread::yield();
+    }
+}
+
+// Producer thread streams n values; the calling thread drains them.
+template <typename Q> uint64_t throughput(size_t n) {
+    Q q(kCapacity);
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < n; ++i)
+            push_spin(q, i);
+    });
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < n; ++i)
+        sum += pop_spin(q);
+    producer.join();
+    return sum;
+}
+
+// A value bounces between two threads through a pair of queues, so the
+// time per round trip is two hand-offs.
+template <typename Q> uint64_t ping_pong(size_t n) {
+    Q ping(kCapacity);
+    Q pong(kCapacity);
+    std::thread echo([&] {
+        for (size_t i = 0; i < n; ++i)
+            push_spin(pong, pop_spin(ping) + 1);
+    });
+
+    uint64_t value = 0;
+    for (size_t i = 0; i < n; ++i) {
+        push_spin(ping, value);
+        value = pop_spin(pong);
+    }
+    echo.join();
+    return value;
+}
+
+} // namespace
+
+TEST_CASE("SPSC queue throughput and latency", "[benchmark]") {
+    BENCHMARK(label("SpscQueue throughput", kMessages)) {
+        return throughput<SpscQueue<uint64_t>>(kMessages);
+    };
+    BENCHMARK(label("mutex+deque throughput", kMessages)) {
+        return throughput<MutexQueue<uint64_t>>(kMessages);
+    };
+
+    BENCHMARK(label("SpscQueue round trips", kRoundTrips)) {
+        return ping_pong<SpscQueue<uint64_t>>(kRoundTrips);
+    };
+    BENCHMARK(label("mutex+deque round trips", kRoundTrips)) {
+        return ping_pong<MutexQueue<uint64_t>>(kRoundTrips);
+    };
+}
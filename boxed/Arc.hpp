@@ -0,0 +1,134 @@
+#ifndef _RUSTISH_BOXED_ARC_HPP_
+#define _RUSTISH_BOXED_ARC_HPP_
+
+#include "../alloc/Global.hpp"
+#include "../option/Option.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace rustish {
+namespace sync {
+template <typename T, typename Alloc> class ArcSwapOption;
+} // namespace sync
+
+namespace boxed {
+
+// Shared, immutable heap value with an atomic reference count. Copying an
+// Arc adds a reference and the value is dropped with the last one. Like
+// Box, an Arc is one pointer that is never null while live, so
+// Option<Arc<T>> uses the null pointer as None and is one pointer too.
+//
+// A moved-from Arc is empty and may only be destroyed or assigned to.
+template <typename T, typename Alloc = alloc::Global> class Arc {
+    struct Inner {
+        template <typename... Args>
+        explicit Inner(Args &&...args)
+            : strong(1), value(std::forward<Args>(args)...) {}
+
+        std::atomic<size_t> strong;
+        T value;
+    };
+
+  public:
+    template <typename... Args> static Arc new_(Args &&...args) {
+        void *mem = Alloc::allocate(sizeof(Inner), alignof(Inner));
+        try {
+            return Arc(new (mem) Inner(std::forward<Args>(args)...));
+        } catch (...) {
+            Alloc::deallocate(mem, sizeof(Inner), alignof(Inner));
+            throw;
+        }
+    }
+
+    Arc(const Arc &other) : m_inner(other.m_inner) { retain(m_inner); }
+
+    Arc &operator=(const Arc &other) {
+        if (m_inner == other.m_inner)
+            return *this;
+
+        retain(other.m_inner);
+        release(m_inner);
+        m_inner = other.m_inner;
+        return *this;
+    }
+
+    Arc(Arc &&other) : m_inner(other.m_inner) { other.m_inner = nullptr; }
+
+    Arc &operator=(Arc &&other) {
+        if (this == &other)
+            return *this;
+
+        release(m_inner);
+        m_inner = other.m_inner;
+        other.m_inner = nullptr;
+        return *this;
+    }
+
+    ~Arc() { release(m_inner); }
+
+    Arc clone() const { return *this; }
+
+    const T &operator*() const { return m_inner->value; }
+
+    const T *operator->() const { return &m_inner->value; }
+
+    const T *as_ptr() const { return &m_inner->value; }
+
+    // Only a snapshot when other threads hold references too.
+    size_t strong_count() const {
+        return m_inner->strong.load(std::memory_order_relaxed);
+    }
+
+    static bool ptr_eq(const Arc &a, const Arc &b) {
+        return a.m_inner == b.m_inner;
+    }
+
+  private:
+    template <typename, typename> friend class sync::ArcSwapOption;
+    friend struct option::NicheTraits<Arc>;
+
+    Arc() : m_inner(nullptr) {}
+
+    explicit Arc(Inner *inner) : m_inner(inner) {}
+
+    static void retain(Inner *inner) {
+        inner->strong.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // The release/acquire pair makes every other owner's use of the value
+    // happen before it is destroyed.
+    static void release(Inner *inner) {
+        if (!inner ||
+            inner->strong.fetch_sub(1, std::memory_order_release) != 1)
+            return;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        inner->~Inner();
+        Alloc::deallocate(inner, sizeof(Inner), alignof(Inner));
+    }
+
+    Inner *m_inner;
+};
+
+} // namespace boxed
+
+namespace option {
+
+template <typename T, typename Alloc>
+struct NicheTraits<boxed::Arc<T, Alloc>> {
+    static constexpr bool available = true;
+
+    static void set_none(void *buff) { new (buff) boxed::Arc<T, Alloc>(); }
+
+    static bool is_none(const void *buff) {
+        return static_cast<const boxed::Arc<T, Alloc> *>(buff)->m_inner ==
+               nullptr;
+    }
+};
+
+} // namespace option
+} // namespace rustish
+
+#endif //_RUSTISH_BOXED_ARC_HPP_
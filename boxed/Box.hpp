@@ -0,0 +1,141 @@
+#ifndef _RUSTISH_BOXED_BOX_HPP_
+#define _RUSTISH_BOXED_BOX_HPP_
+
+#include "../alloc/Global.hpp"
+#include "../option/Option.hpp"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rustish {
+namespace boxed {
+namespace detail {
+
+// The resource an allocation policy frees into, or void for policies such
+// as alloc::Global that allocate on their own.
+template <typename Alloc, typename = void> struct ResourceOf {
+    using type = void;
+};
+
+template <typename Alloc>
+struct ResourceOf<Alloc, typename std::conditional<
+                             true, void, typename Alloc::resource>::type> {
+    using type = typename Alloc::resource;
+};
+
+} // namespace detail
+
+// Owning pointer to a single heap value. Alloc is a stateless allocation
+// policy (alloc::Global, alloc::ArenaAlloc, alloc::PoolAlloc) so a Box is
+// exactly one pointer, and because a live Box is never null,
+// Option<Box<T>> uses the null pointer as None and is one pointer too.
+//
+// A moved-from Box is empty and may only be destroyed or assigned to.
+template <typename T, typename Alloc = alloc::Global> class Box {
+  public:
+    template <typename... Args> static Box new_(Args &&...args) {
+        void *mem = Alloc::allocate(sizeof(T), alignof(T));
+        return Box(construct(mem, std::forward<Args>(args)...));
+    }
+
+    // Allocates from resource (an alloc::Arena or alloc::Pool). The value
+    // is handed back to Alloc when the Box is dropped, so Alloc must be the
+    // policy for that resource.
+    template <typename Resource, typename... Args>
+    static Box new_in(Resource &resource, Args &&...args) {
+        static_assert(
+            std::is_same<Resource,
+                         typename detail::ResourceOf<Alloc>::type>::value,
+            "new_in needs the Alloc policy that frees into Resource: "
+            "ArenaAlloc for an Arena, PoolAlloc for a Pool");
+        void *mem = resource.allocate(sizeof(T), alignof(T));
+        return Box(construct(mem, std::forward<Args>(args)...));
+    }
+
+    Box(const Box &) = delete;
+    Box &operator=(const Box &) = delete;
+
+    Box(Box &&other) : m_ptr(other.m_ptr) { other.m_ptr = nullptr; }
+
+    Box &operator=(Box &&other) {
+        if (this == &other)
+            return *this;
+
+        drop();
+        m_ptr = other.m_ptr;
+        other.m_ptr = nullptr;
+        return *this;
+    }
+
+    ~Box() { drop(); }
+
+    T &operator*() const { return *m_ptr; }
+
+    T *operator->() const { return m_ptr; }
+
+    T *as_ptr() const { return m_ptr; }
+
+    // Moves the value out and frees the allocation.
+    T into_inner() {
+        T ret(std::move(*m_ptr));
+        drop();
+        return ret;
+    }
+
+    // Gives up ownership without running the destructor. Useful for arena
+    // allocated trees that are torn down all at once by Arena::reset.
+    T &leak() {
+        T *ptr = m_ptr;
+        m_ptr = nullptr;
+        return *ptr;
+    }
+
+  private:
+    friend struct option::NicheTraits<Box>;
+
+    Box() : m_ptr(nullptr) {}
+
+    explicit Box(T *ptr) : m_ptr(ptr) {}
+
+    template <typename... Args> static T *construct(void *mem, Args &&...args) {
+        try {
+            return new (mem) T(std::forward<Args>(args)...);
+        } catch (...) {
+            Alloc::deallocate(mem, sizeof(T), alignof(T));
+            throw;
+        }
+    }
+
+    void drop() {
+        if (m_ptr) {
+            m_ptr->~T();
+            Alloc::deallocate(m_ptr, sizeof(T), alignof(T));
+            m_ptr = nullptr;
+        }
+    }
+
+    T *m_ptr;
+};
+
+} // namespace boxed
+
+namespace option {
+
+template <typename T, typename Alloc>
+struct NicheTraits<boxed::Box<T, Alloc>> {
+    static constexpr bool available = true;
+
+    static void set_none(void *buff) { new (buff) boxed::Box<T, Alloc>(); }
+
+    static bool is_none(const void *buff) {
+        return static_cast<const boxed::Box<T, Alloc> *>(buff)->m_ptr ==
+               nullptr;
+    }
+};
+
+} // namespace option
+} // namespace rustish
+
+#endif //_RUSTISH_BOXED_BOX_HPP_
@@ -0,0 +1,183 @@
+#ifndef _RUSTISH_CODEC_DECODER_HPP_
+#define _RUSTISH_CODEC_DECODER_HPP_
+
+#include "../option/Option.hpp"
+#include "Encoder.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace rustish {
+namespace codec {
+
+inline int64_t unzigzag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+// Streaming decoder for the format written by Encoder, reading from a
+// caller owned byte span. The span must outlive every reference returned by
+// read_raw()/read_option_ref().
+//
+// Malformed or truncated input is sticky: ok() turns false and every later
+// read returns None, so a caller can decode a whole record and check once.
+// Because of that, a None from read_option() means "absent" only while ok()
+// is still true.
+class Decoder {
+  public:
+    Decoder(const uint8_t *data, size_t len) : m_data(data), m_len(len) {}
+
+    bool ok() const { return m_ok; }
+
+    size_t position() const { return m_pos; }
+
+    size_t remaining() const { return m_len - m_pos; }
+
+    option::Option<uint64_t> read_varint() {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            if (!m_ok || m_pos == m_len)
+                return fail<uint64_t>();
+            uint8_t byte = m_data[m_pos++];
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return option::Option<uint64_t>(value);
+        }
+        return fail<uint64_t>();
+    }
+
+    template <typename T> option::Option<T> read() {
+        return read_value(static_cast<T *>(nullptr));
+    }
+
+    // Reference to a value written with Encoder::write_raw, pointing into
+    // the input. Fails if the input buffer is not aligned for T.
+    template <typename T> option::Option<const T &> read_raw() {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "read_raw requires a trivially copyable type");
+        size_t pad = (alignof(T) - m_pos % alignof(T)) % alignof(T);
+        if (!m_ok || remaining() < pad + sizeof(T) ||
+            reinterpret_cast<uintptr_t>(m_data) % alignof(T) != 0) {
+            m_ok = false;
+            return {};
+        }
+
+        const T *ptr = reinterpret_cast<const T *>(m_data + m_pos + pad);
+        m_pos += pad + sizeof(T);
+        return option::Option<const T &>(*ptr);
+    }
+
+    void begin_options(size_t count) {
+        size_t bytes = (count + 7) / 8;
+        if (!m_ok || remaining() < bytes) {
+            m_ok = false;
+            return;
+        }
+        m_bitmap = m_pos;
+        m_bit = 0;
+        m_bits_left = count;
+        m_pos += bytes;
+    }
+
+    template <typename T> option::Option<T> read_option() {
+        if (next_present())
+            return read<T>();
+        return {};
+    }
+
+    template <typename T> option::Option<const T &> read_option_ref() {
+        if (next_present())
+            return read_raw<T>();
+        return {};
+    }
+
+    template <typename T>
+    void read_option_column(option::Option<T> *out, size_t n) {
+        begin_options(n);
+        for (size_t i = 0; i < n; ++i)
+            out[i] = read_option<T>();
+    }
+
+  private:
+    template <typename T> option::Option<T> fail() {
+        m_ok = false;
+        return {};
+    }
+
+    bool next_present() {
+        if (!m_ok || m_bits_left == 0) {
+            m_ok = false;
+            return false;
+        }
+        bool present = (m_data[m_bitmap + m_bit / 8] >> (m_bit % 8)) & 1;
+        ++m_bit;
+        --m_bits_left;
+        return present;
+    }
+
+    option::Option<bool> read_value(bool *) {
+        if (!m_ok || remaining() < 1)
+            return fail<bool>();
+        uint8_t byte = m_data[m_pos++];
+        if (byte > 1)
+            return fail<bool>();
+        return option::Option<bool>(byte == 1);
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value &&
+                                std::is_unsigned<T>::value,
+                            option::Option<T>>::type
+    read_value(T *) {
+        option::Option<uint64_t> raw = read_varint();
+        if (raw.is_none())
+            return {};
+        uint64_t value = raw.unwrap_unchecked();
+        if (value > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+            return fail<T>();
+        return option::Option<T>(static_cast<T>(value));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value &&
+                                std::is_signed<T>::value,
+                            option::Option<T>>::type
+    read_value(T *) {
+        option::Option<uint64_t> raw = read_varint();
+        if (raw.is_none())
+            return {};
+        int64_t value = unzigzag(raw.unwrap_unchecked());
+        if (value < static_cast<int64_t>(std::numeric_limits<T>::min()) ||
+            value > static_cast<int64_t>(std::numeric_limits<T>::max()))
+            return fail<T>();
+        return option::Option<T>(static_cast<T>(value));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value,
+                            option::Option<T>>::type
+    read_value(T *) {
+        if (!m_ok || remaining() < sizeof(T))
+            return fail<T>();
+        T value;
+        std::memcpy(&value, m_data + m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return option::Option<T>(value);
+    }
+
+    const uint8_t *m_data;
+    size_t m_len;
+    size_t m_pos = 0;
+    bool m_ok = true;
+
+    size_t m_bitmap = 0;
+    size_t m_bit = 0;
+    size_t m_bits_left = 0;
+};
+
+} // namespace codec
+} // namespace rustish
+
+#endif //_RUSTISH_CODEC_DECODER_HPP_
@@ -0,0 +1,184 @@
+#ifndef _RUSTISH_CODEC_ENCODER_HPP_
+#define _RUSTISH_CODEC_ENCODER_HPP_
+
+#include "../option/Option.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace rustish {
+namespace codec {
+
+// Longest LEB128 encoding of a 64 bit value.
+static constexpr size_t max_varint_len = 10;
+
+inline uint64_t zigzag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^
+           static_cast<uint64_t>(value >> 63);
+}
+
+// Streaming binary encoder writing into a caller owned byte span.
+//
+// Wire format:
+//  - unsigned integers are LEB128 varints, signed integers are zigzag
+//    varints, bool is one byte and floating point is fixed width in host
+//    byte order (little endian on every supported target).
+//  - write_raw() copies a trivially copyable value verbatim, padded to its
+//    alignment from the start of the buffer, so Decoder can hand out a
+//    reference into the input instead of a copy.
+//  - Option fields are grouped: begin_options(n) reserves an n bit presence
+//    bitmap and the next n write_option*() calls fill it, writing a payload
+//    only for Some. A group can be a struct's Option fields or a whole
+//    column of Options.
+//
+// Running out of space is sticky: ok() turns false and later writes are
+// dropped, so a caller only needs to check once at the end.
+class Encoder {
+  public:
+    Encoder(uint8_t *data, size_t len) : m_data(data), m_cap(len) {}
+
+    bool ok() const { return m_ok; }
+
+    // Bytes written so far.
+    size_t len() const { return m_pos; }
+
+    void write_varint(uint64_t value) {
+        if (m_ok && m_cap - m_pos >= max_varint_len) {
+            while (value >= 0x80) {
+                m_data[m_pos++] = static_cast<uint8_t>(value | 0x80);
+                value >>= 7;
+            }
+            m_data[m_pos++] = static_cast<uint8_t>(value);
+            return;
+        }
+
+        uint8_t tmp[max_varint_len];
+        size_t n = 0;
+        while (value >= 0x80) {
+            tmp[n++] = static_cast<uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        tmp[n++] = static_cast<uint8_t>(value);
+        write_bytes(tmp, n);
+    }
+
+    void write_bytes(const void *bytes, size_t n) {
+        if (!reserve(n))
+            return;
+        std::memcpy(m_data + m_pos, bytes, n);
+        m_pos += n;
+    }
+
+    template <typename T> void write(const T &value) { write_value(value); }
+
+    template <typename T> void write_raw(const T &value) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "write_raw requires a trivially copyable type");
+        pad_to(alignof(T));
+        write_bytes(&value, sizeof(T));
+    }
+
+    void begin_options(size_t count) {
+        assert(m_bits_left == 0 && "previous Option group not finished");
+        // The group is counted even when the bitmap does not fit, so the
+        // write_option*() calls that follow are dropped rather than
+        // tripping the assert in mark_present().
+        m_bit = 0;
+        m_bits_left = count;
+        size_t bytes = (count + 7) / 8;
+        if (!reserve(bytes))
+            return;
+        std::memset(m_data + m_pos, 0, bytes);
+        m_bitmap = m_pos;
+        m_pos += bytes;
+    }
+
+    template <typename T> void write_option(const option::Option<T> &value) {
+        if (mark_present(value.is_some()))
+            write_value(value.as_ref().unwrap());
+    }
+
+    template <typename T>
+    void write_option_raw(const option::Option<T> &value) {
+        if (mark_present(value.is_some()))
+            write_raw(value.as_ref().unwrap());
+    }
+
+    // One presence group followed by the payloads of every Some.
+    template <typename T>
+    void write_option_column(const option::Option<T> *values, size_t n) {
+        begin_options(n);
+        for (size_t i = 0; i < n; ++i)
+            write_option(values[i]);
+    }
+
+  private:
+    bool reserve(size_t n) {
+        if (m_ok && m_cap - m_pos >= n)
+            return true;
+        m_ok = false;
+        return false;
+    }
+
+    void pad_to(size_t align) {
+        size_t pad = (align - m_pos % align) % align;
+        if (!reserve(pad))
+            return;
+        std::memset(m_data + m_pos, 0, pad);
+        m_pos += pad;
+    }
+
+    bool mark_present(bool present) {
+        assert(m_bits_left > 0 && "write_option outside of begin_options");
+        --m_bits_left;
+        if (!m_ok)
+            return false;
+        if (present)
+            m_data[m_bitmap + m_bit / 8] |=
+                static_cast<uint8_t>(1 << (m_bit % 8));
+        ++m_bit;
+        return present;
+    }
+
+    void write_value(bool value) {
+        uint8_t byte = value ? 1 : 0;
+        write_bytes(&byte, 1);
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value &&
+                            std::is_unsigned<T>::value>::type
+    write_value(T value) {
+        write_varint(value);
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value &&
+                            std::is_signed<T>::value>::type
+    write_value(T value) {
+        write_varint(zigzag(value));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type
+    write_value(T value) {
+        write_bytes(&value, sizeof(T));
+    }
+
+    uint8_t *m_data;
+    size_t m_cap;
+    size_t m_pos = 0;
+    bool m_ok = true;
+
+    size_t m_bitmap = 0;
+    size_t m_bit = 0;
+    size_t m_bits_left = 0;
+};
+
+} // namespace codec
+} // namespace rustish
+
+#endif //_RUSTISH_CODEC_ENCODER_HPP_
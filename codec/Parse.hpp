@@ -0,0 +1,307 @@
+#ifndef _RUSTISH_CODEC_PARSE_HPP_
+#define _RUSTISH_CODEC_PARSE_HPP_
+
+#include "../option/Option.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<string_view>)
+#include <string_view>
+#define RUSTISH_HAS_STRING_VIEW 1
+#endif
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+// Floating point from_chars arrived years after the integer overloads, and
+// only the library feature macro tells them apart.
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define RUSTISH_PARSE_FLOAT_FROM_CHARS 1
+#endif
+
+// Eight digits at a time in a 64 bit word needs the first character in the
+// low byte.
+#if !defined(RUSTISH_PARSE_NO_SWAR) &&                                         \
+    ((defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || \
+     defined(_M_X64) || defined(_M_IX86) || defined(_M_ARM64))
+#define RUSTISH_PARSE_SWAR 1
+#endif
+
+#ifndef RUSTISH_HAS_STRING_VIEW
+#define RUSTISH_HAS_STRING_VIEW 0
+#endif
+#ifndef RUSTISH_PARSE_FLOAT_FROM_CHARS
+#define RUSTISH_PARSE_FLOAT_FROM_CHARS 0
+#endif
+#ifndef RUSTISH_PARSE_SWAR
+#define RUSTISH_PARSE_SWAR 0
+#endif
+
+namespace rustish {
+namespace codec {
+namespace detail {
+
+#if RUSTISH_PARSE_SWAR
+// Whether all eight bytes are '0'..'9': the high nibble must be 3, and must
+// still be 3 after adding 6, which carries out of any low nibble above 9.
+inline bool is_eight_digits(uint64_t chunk) {
+    return (((chunk & 0xF0F0F0F0F0F0F0F0ull) |
+             (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >>
+              4)) == 0x3333333333333333ull);
+}
+
+// Value of eight ASCII digits, first digit in the low byte. Combines
+// neighbouring digits into pairs, then pairs into the final value with two
+// multiplies whose high halves line up.
+inline uint32_t eight_digits(uint64_t chunk) {
+    const uint64_t mask = 0x000000FF000000FFull;
+    const uint64_t mul1 = 100 + (1000000ull << 32);
+    const uint64_t mul2 = 1 + (10000ull << 32);
+    chunk -= 0x3030303030303030ull;
+    chunk = chunk * 10 + (chunk >> 8);
+    return static_cast<uint32_t>(
+        ((chunk & mask) * mul1 + ((chunk >> 16) & mask) * mul2) >> 32);
+}
+#endif
+
+// Accumulates the decimal digits in [first, last) into *value. Fails on an
+// empty run, a non-digit or a value that does not fit in 64 bits.
+inline bool parse_digits(const char *first, const char *last,
+                         uint64_t *value) {
+    if (first == last)
+        return false;
+
+    // Leading zeros never overflow, and skipping them lets the digit count
+    // bound the value.
+    while (first != last && *first == '0')
+        ++first;
+    size_t digits = static_cast<size_t>(last - first);
+    if (digits > 20)
+        return false;
+
+    uint64_t acc = 0;
+#if RUSTISH_PARSE_SWAR
+    // At most two chunks, so 16 digit values take no per-digit loop and the
+    // accumulator stays below 10^16.
+    while (last - first >= 8) {
+        uint64_t chunk;
+        std::memcpy(&chunk, first, sizeof(chunk));
+        if (!is_eight_digits(chunk))
+            return false;
+        acc = acc * 100000000 + eight_digits(chunk);
+        first += 8;
+    }
+#endif
+    for (; first != last; ++first) {
+        unsigned digit = static_cast<unsigned char>(*first) - unsigned('0');
+        if (digit > 9)
+            return false;
+        // Only a 20 digit value can exceed UINT64_MAX.
+        if (digits == 20 && acc > (UINT64_MAX - digit) / 10)
+            return false;
+        acc = acc * 10 + digit;
+    }
+    *value = acc;
+    return true;
+}
+
+template <typename T>
+typename std::enable_if<std::is_unsigned<T>::value, option::Option<T>>::type
+parse_integer(const char *first, const char *last) {
+    if (first != last && *first == '+')
+        ++first;
+    uint64_t value;
+    if (!parse_digits(first, last, &value) ||
+        value > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+        return {};
+    return option::Option<T>(static_cast<T>(value));
+}
+
+template <typename T>
+typename std::enable_if<std::is_signed<T>::value, option::Option<T>>::type
+parse_integer(const char *first, const char *last) {
+    bool negative = false;
+    if (first != last && (*first == '+' || *first == '-')) {
+        negative = *first == '-';
+        ++first;
+    }
+    uint64_t value;
+    if (!parse_digits(first, last, &value))
+        return {};
+
+    const uint64_t max = static_cast<uint64_t>(std::numeric_limits<T>::max());
+    if (!negative) {
+        if (value > max)
+            return {};
+        return option::Option<T>(static_cast<T>(value));
+    }
+    // |min| is max + 1, which -value would overflow for int64_t.
+    if (value > max + 1)
+        return {};
+    if (value == 0)
+        return option::Option<T>(T(0));
+    return option::Option<T>(
+        static_cast<T>(-static_cast<int64_t>(value - 1) - 1));
+}
+
+#if !RUSTISH_PARSE_FLOAT_FROM_CHARS
+inline float strto(const char *str, char **end, float *) {
+    return std::strtof(str, end);
+}
+
+inline double strto(const char *str, char **end, double *) {
+    return std::strtod(str, end);
+}
+
+inline long double strto(const char *str, char **end, long double *) {
+    return std::strtold(str, end);
+}
+#endif
+
+template <typename T>
+option::Option<T> parse_float(const char *first, const char *last) {
+    // from_chars takes no '+', but Rust's parse does.
+    if (first != last && *first == '+') {
+        ++first;
+        if (first != last && *first == '-')
+            return {};
+    }
+    if (first == last)
+        return {};
+
+#if RUSTISH_PARSE_FLOAT_FROM_CHARS
+    T value;
+    std::from_chars_result res = std::from_chars(first, last, value);
+    if (res.ec != std::errc() || res.ptr != last)
+        return {};
+    return option::Option<T>(value);
+#else
+    // strto* would skip leading space and accept hex, neither of which
+    // from_chars does. It also follows the C locale's decimal point.
+    if (*first == ' ' || (*first >= '\t' && *first <= '\r'))
+        return {};
+    for (const char *p = first; p != last; ++p) {
+        if (*p == 'x' || *p == 'X' || *p == '\0')
+            return {};
+    }
+
+    // Needs a terminator, so copy the field; short ones stay on the stack.
+    size_t len = static_cast<size_t>(last - first);
+    char small[64];
+    std::string big;
+    const char *str = small;
+    if (len < sizeof(small)) {
+        std::memcpy(small, first, len);
+        small[len] = '\0';
+    } else {
+        big.assign(first, len);
+        str = big.c_str();
+    }
+
+    char *end;
+    int saved = errno;
+    errno = 0;
+    T value = strto(str, &end, static_cast<T *>(nullptr));
+    bool range = errno == ERANGE;
+    errno = saved;
+    if (end != str + len || range)
+        return {};
+    return option::Option<T>(value);
+#endif
+}
+
+template <typename T, typename Enable = void> struct Parser {
+    static_assert(sizeof(T) == 0,
+                  "parse<T>() supports bool, integers up to 64 bits and "
+                  "floating point");
+};
+
+template <> struct Parser<bool> {
+    static option::Option<bool> parse(const char *first, const char *last) {
+        size_t len = static_cast<size_t>(last - first);
+        if (len == 4 && std::memcmp(first, "true", 4) == 0)
+            return option::Option<bool>(true);
+        if (len == 5 && std::memcmp(first, "false", 5) == 0)
+            return option::Option<bool>(false);
+        return {};
+    }
+};
+
+template <typename T>
+struct Parser<T, typename std::enable_if<std::is_integral<T>::value &&
+                                         !std::is_same<T, bool>::value &&
+                                         sizeof(T) <= sizeof(uint64_t)>::type> {
+    static option::Option<T> parse(const char *first, const char *last) {
+        return parse_integer<T>(first, last);
+    }
+};
+
+template <typename T>
+struct Parser<T,
+              typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    static option::Option<T> parse(const char *first, const char *last) {
+        return parse_float<T>(first, last);
+    }
+};
+
+} // namespace detail
+
+// Parses the whole of [first, last) as a T, like Rust's str::parse: None
+// for empty input, stray characters (including surrounding whitespace) or
+// a value out of T's range. Integers are decimal with an optional sign and
+// never allocate; floats take what from_chars does, plus a leading '+'.
+// bool accepts exactly "true" and "false".
+template <typename T>
+option::Option<T> parse(const char *first, const char *last) {
+    return detail::Parser<typename std::remove_cv<T>::type>::parse(first,
+                                                                   last);
+}
+
+#if RUSTISH_HAS_STRING_VIEW
+template <typename T> option::Option<T> parse(std::string_view str) {
+    return parse<T>(str.data(), str.data() + str.size());
+}
+#else
+template <typename T> option::Option<T> parse(const std::string &str) {
+    return parse<T>(str.data(), str.data() + str.size());
+}
+#endif
+
+// Parses each delim separated field of [data, data + len) and pushes the
+// result onto column, which may be anything with a push(Option<T>): a
+// Vec<Option<T>>, an io::ColumnWriter<T>... Empty and malformed fields
+// become None rather than stopping the scan. A trailing delimiter ends the
+// last field instead of starting an empty one. Returns the number of
+// fields pushed.
+template <typename T, typename Column>
+size_t parse_delimited(const char *data, size_t len, char delim,
+                       Column &column) {
+    const char *first = data;
+    const char *end = data + len;
+    size_t fields = 0;
+    while (first != end) {
+        const char *next = static_cast<const char *>(
+            std::memchr(first, delim, static_cast<size_t>(end - first)));
+        const char *last = next ? next : end;
+        column.push(parse<T>(first, last));
+        ++fields;
+        if (!next)
+            break;
+        first = next + 1;
+    }
+    return fields;
+}
+
+} // namespace codec
+} // namespace rustish
+
+#endif //_RUSTISH_CODEC_PARSE_HPP_
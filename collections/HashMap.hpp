@@ -0,0 +1,433 @@
+#ifndef _RUSTISH_COLLECTIONS_HASH_MAP_HPP_
+#define _RUSTISH_COLLECTIONS_HASH_MAP_HPP_
+
+#include "../option/Option.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if !defined(RUSTISH_HASH_MAP_NO_SIMD) &&                                      \
+    (defined(__SSE2__) || defined(_M_X64) ||                                   \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define RUSTISH_HASH_MAP_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace rustish {
+namespace collections {
+namespace detail {
+
+// Every slot has one control byte. Full slots store the low 7 bits of the
+// hash (H2) so a whole group of slots can be filtered with a single compare
+// before any key is touched. Empty and deleted slots have the high bit set.
+using ctrl_t = int8_t;
+
+static constexpr ctrl_t kEmpty = -128;
+static constexpr ctrl_t kDeleted = -2;
+
+inline bool is_full(ctrl_t c) { return c >= 0; }
+
+inline uint32_t trailing_zeros(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_ctzll(x));
+#else
+    uint32_t n = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+inline uint32_t highest_bit(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - static_cast<uint32_t>(__builtin_clzll(x));
+#else
+    uint32_t n = 0;
+    while (x >>= 1)
+        ++n;
+    return n;
+#endif
+}
+
+// Set of matching slot offsets within a group. Shift converts a bit index to
+// a slot offset (0 for the SSE2 movemask, 3 for the byte-wise portable mask).
+template <uint32_t Shift> class BitMask {
+  public:
+    explicit BitMask(uint64_t mask) : m_mask(mask) {}
+
+    explicit operator bool() const { return m_mask != 0; }
+
+    uint32_t lowest() const { return trailing_zeros(m_mask) >> Shift; }
+
+    uint32_t highest() const { return highest_bit(m_mask) >> Shift; }
+
+    void clear_lowest() { m_mask &= m_mask - 1; }
+
+  private:
+    uint64_t m_mask;
+};
+
+#ifdef RUSTISH_HASH_MAP_SSE2
+struct Group {
+    static constexpr size_t width = 16;
+    using mask_t = BitMask<0>;
+
+    explicit Group(const ctrl_t *pos)
+        : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {}
+
+    mask_t match(ctrl_t h2) const {
+        return mask_t(static_cast<uint16_t>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl))));
+    }
+
+    mask_t match_empty() const { return match(kEmpty); }
+
+    // Empty (-128) and deleted (-2) are the only control bytes below -1.
+    mask_t match_empty_or_deleted() const {
+        return mask_t(static_cast<uint16_t>(_mm_movemask_epi8(
+            _mm_cmpgt_epi8(_mm_set1_epi8(-1), m_ctrl))));
+    }
+
+  private:
+    __m128i m_ctrl;
+};
+#else
+// Portable fallback that treats eight control bytes as one 64 bit word.
+// match() may report false positives; they are filtered by the key compare.
+struct Group {
+    static constexpr size_t width = 8;
+    using mask_t = BitMask<3>;
+
+    static constexpr uint64_t lsbs = 0x0101010101010101ull;
+    static constexpr uint64_t msbs = 0x8080808080808080ull;
+
+    explicit Group(const ctrl_t *pos) { std::memcpy(&m_ctrl, pos, width); }
+
+    mask_t match(ctrl_t h2) const {
+        uint64_t x = m_ctrl ^ (lsbs * static_cast<uint8_t>(h2));
+        return mask_t((x - lsbs) & ~x & msbs);
+    }
+
+    mask_t match_empty() const {
+        return mask_t((m_ctrl & (~m_ctrl << 6)) & msbs);
+    }
+
+    mask_t match_empty_or_deleted() const {
+        return mask_t((m_ctrl & (~m_ctrl << 7)) & msbs);
+    }
+
+  private:
+    uint64_t m_ctrl;
+};
+#endif
+
+// std::hash is the identity for integers, so spread the bits before they are
+// split into the probe start (H1) and the control byte tag (H2).
+inline uint64_t mix_hash(size_t hash) {
+    uint64_t h = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 32);
+}
+
+} // namespace detail
+
+// Open addressing hash map laid out as one flat array of slots plus one
+// control byte per slot. Lookups probe a group of control bytes at a time
+// (16 with SSE2, 8 otherwise) and only compare keys whose H2 tag matches.
+// Not thread safe.
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>>
+class HashMap {
+    struct Slot {
+        K key;
+        V value;
+    };
+
+    using ctrl_t = detail::ctrl_t;
+    using Group = detail::Group;
+
+  public:
+    HashMap() {}
+
+    explicit HashMap(size_t capacity) { reserve(capacity); }
+
+    HashMap(const HashMap &) = delete;
+    HashMap &operator=(const HashMap &) = delete;
+
+    HashMap(HashMap &&other)
+        : m_ctrl(other.m_ctrl), m_slots(other.m_slots),
+          m_capacity(other.m_capacity), m_size(other.m_size),
+          m_growth_left(other.m_growth_left) {
+        other.reset_empty();
+    }
+
+    HashMap &operator=(HashMap &&other) {
+        if (this == &other)
+            return *this;
+
+        destroy();
+        m_ctrl = other.m_ctrl;
+        m_slots = other.m_slots;
+        m_capacity = other.m_capacity;
+        m_size = other.m_size;
+        m_growth_left = other.m_growth_left;
+        other.reset_empty();
+        return *this;
+    }
+
+    ~HashMap() { destroy(); }
+
+    size_t len() const { return m_size; }
+
+    bool is_empty() const { return m_size == 0; }
+
+    size_t capacity() const { return max_load(m_capacity); }
+
+    bool contains_key(const K &key) const { return find(key) != npos; }
+
+    option::Option<V &> get(const K &key) {
+        size_t idx = find(key);
+        if (idx != npos)
+            return option::Option<V &>(m_slots[idx].value);
+        return {};
+    }
+
+    option::Option<const V &> get(const K &key) const {
+        size_t idx = find(key);
+        if (idx != npos)
+            return option::Option<const V &>(m_slots[idx].value);
+        return {};
+    }
+
+    // Returns the previous value when the key was already present.
+    template <typename Key, typename Value>
+    option::Option<V> insert(Key &&key, Value &&value) {
+        uint64_t hash = detail::mix_hash(m_hash(key));
+        size_t idx = find(key, hash);
+        if (idx != npos) {
+            option::Option<V> old(std::move(m_slots[idx].value));
+            m_slots[idx].value = std::forward<Value>(value);
+            return old;
+        }
+
+        idx = find_insert_slot(hash);
+        new (&m_slots[idx])
+            Slot{K(std::forward<Key>(key)), V(std::forward<Value>(value))};
+        commit_insert(idx, hash);
+        return {};
+    }
+
+    option::Option<V> remove(const K &key) {
+        size_t idx = find(key);
+        if (idx == npos)
+            return {};
+
+        option::Option<V> ret(std::move(m_slots[idx].value));
+        erase_at(idx);
+        return ret;
+    }
+
+    void clear() {
+        destroy();
+        reset_empty();
+    }
+
+    void reserve(size_t additional) {
+        size_t wanted = m_size + additional;
+        if (wanted <= capacity())
+            return;
+
+        size_t cap = Group::width;
+        while (max_load(cap) < wanted)
+            cap *= 2;
+        resize(cap);
+    }
+
+    template <typename Func> void for_each(Func &&f) {
+        for (size_t i = 0; i < m_capacity; ++i)
+            if (detail::is_full(m_ctrl[i]))
+                f(static_cast<const K &>(m_slots[i].key), m_slots[i].value);
+    }
+
+    template <typename Func> void for_each(Func &&f) const {
+        for (size_t i = 0; i < m_capacity; ++i)
+            if (detail::is_full(m_ctrl[i]))
+                f(m_slots[i].key, m_slots[i].value);
+    }
+
+  private:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // At most 7/8 of the slots are ever full, so every probe sequence is
+    // guaranteed to reach an empty control byte.
+    static size_t max_load(size_t cap) { return cap - cap / 8; }
+
+    static ctrl_t h2(uint64_t hash) { return static_cast<ctrl_t>(hash & 0x7F); }
+
+    static size_t h1(uint64_t hash) { return static_cast<size_t>(hash >> 7); }
+
+    size_t find(const K &key) const {
+        return find(key, detail::mix_hash(m_hash(key)));
+    }
+
+    size_t find(const K &key, uint64_t hash) const {
+        if (m_capacity == 0)
+            return npos;
+
+        size_t mask = m_capacity - 1;
+        size_t pos = h1(hash) & mask;
+        ctrl_t tag = h2(hash);
+        for (size_t step = Group::width;; step += Group::width) {
+            Group g(m_ctrl + pos);
+            for (auto m = g.match(tag); m; m.clear_lowest()) {
+                size_t idx = (pos + m.lowest()) & mask;
+                if (m_eq(m_slots[idx].key, key))
+                    return idx;
+            }
+            if (g.match_empty())
+                return npos;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    // First empty or deleted slot on the probe sequence of hash.
+    size_t find_free(uint64_t hash) const {
+        size_t mask = m_capacity - 1;
+        size_t pos = h1(hash) & mask;
+        for (size_t step = Group::width;; step += Group::width) {
+            auto m = Group(m_ctrl + pos).match_empty_or_deleted();
+            if (m)
+                return (pos + m.lowest()) & mask;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    // Slot for a new entry with this hash, growing the table if needed. The
+    // slot stays free until commit_insert(), so a key or value constructor
+    // that throws leaves no full slot without an object in it.
+    size_t find_insert_slot(uint64_t hash) {
+        if (m_capacity == 0)
+            resize(Group::width);
+
+        size_t idx = find_free(hash);
+        if (m_growth_left == 0 && m_ctrl[idx] != detail::kDeleted) {
+            rehash_for_insert();
+            idx = find_free(hash);
+        }
+        return idx;
+    }
+
+    // Marks the slot from find_insert_slot() full once its Slot is built.
+    void commit_insert(size_t idx, uint64_t hash) {
+        if (m_ctrl[idx] == detail::kEmpty)
+            --m_growth_left;
+        set_ctrl(idx, h2(hash));
+        ++m_size;
+    }
+
+    // Grows the table, or rebuilds it in place when most of the used
+    // growth has been eaten by deleted slots.
+    void rehash_for_insert() {
+        if (m_size * 2 < max_load(m_capacity))
+            resize(m_capacity);
+        else
+            resize(m_capacity * 2);
+    }
+
+    void erase_at(size_t idx) {
+        m_slots[idx].~Slot();
+        --m_size;
+
+        // A probe only moves past a window of Group::width full or deleted
+        // slots. If the run of non-empty slots around idx is shorter than
+        // that, no probe sequence went through idx and it can become empty
+        // again instead of leaving a tombstone.
+        size_t mask = m_capacity - 1;
+        auto before = Group(m_ctrl + ((idx - Group::width) & mask)).match_empty();
+        auto after = Group(m_ctrl + idx).match_empty();
+        size_t run_before = before ? Group::width - 1 - before.highest()
+                                   : Group::width;
+        size_t run_after = after ? after.lowest() : Group::width;
+        if (run_before + run_after < Group::width) {
+            set_ctrl(idx, detail::kEmpty);
+            ++m_growth_left;
+        } else {
+            set_ctrl(idx, detail::kDeleted);
+        }
+    }
+
+    // The first Group::width control bytes are mirrored after the end of the
+    // array so a group load starting near the end never wraps.
+    void set_ctrl(size_t idx, ctrl_t c) {
+        m_ctrl[idx] = c;
+        if (idx < Group::width)
+            m_ctrl[m_capacity + idx] = c;
+    }
+
+    void resize(size_t new_capacity) {
+        ctrl_t *old_ctrl = m_ctrl;
+        Slot *old_slots = m_slots;
+        size_t old_capacity = m_capacity;
+
+        m_ctrl = new ctrl_t[new_capacity + Group::width];
+        std::memset(m_ctrl, static_cast<uint8_t>(detail::kEmpty),
+                    new_capacity + Group::width);
+        m_slots = std::allocator<Slot>().allocate(new_capacity);
+        m_capacity = new_capacity;
+        m_growth_left = max_load(new_capacity) - m_size;
+
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (!detail::is_full(old_ctrl[i]))
+                continue;
+
+            uint64_t hash = detail::mix_hash(m_hash(old_slots[i].key));
+            size_t idx = find_free(hash);
+            set_ctrl(idx, h2(hash));
+            new (&m_slots[idx]) Slot(std::move(old_slots[i]));
+            old_slots[i].~Slot();
+        }
+
+        if (old_capacity) {
+            delete[] old_ctrl;
+            std::allocator<Slot>().deallocate(old_slots, old_capacity);
+        }
+    }
+
+    void destroy() {
+        if (m_capacity == 0)
+            return;
+
+        for (size_t i = 0; i < m_capacity; ++i)
+            if (detail::is_full(m_ctrl[i]))
+                m_slots[i].~Slot();
+        delete[] m_ctrl;
+        std::allocator<Slot>().deallocate(m_slots, m_capacity);
+    }
+
+    void reset_empty() {
+        m_ctrl = nullptr;
+        m_slots = nullptr;
+        m_capacity = 0;
+        m_size = 0;
+        m_growth_left = 0;
+    }
+
+    ctrl_t *m_ctrl = nullptr;
+    Slot *m_slots = nullptr;
+    size_t m_capacity = 0;
+    size_t m_size = 0;
+    size_t m_growth_left = 0;
+    Hash m_hash;
+    KeyEqual m_eq;
+};
+
+} // namespace collections
+} // namespace rustish
+
+#endif //_RUSTISH_COLLECTIONS_HASH_MAP_HPP_
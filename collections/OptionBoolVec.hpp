@@ -0,0 +1,139 @@
+#ifndef _RUSTISH_COLLECTIONS_OPTION_BOOL_VEC_HPP_
+#define _RUSTISH_COLLECTIONS_OPTION_BOOL_VEC_HPP_
+
+#include "../option/Option.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rustish {
+namespace collections {
+
+// Growable array of Option<bool> packed into 2 bits per element. Presence
+// and value bits live in two separate bitmaps so counts are a popcount over
+// whole 64 bit words rather than a per-element decode.
+class OptionBoolVec {
+  public:
+    OptionBoolVec() {}
+
+    explicit OptionBoolVec(size_t len) { resize(len); }
+
+    size_t len() const { return m_len; }
+
+    bool is_empty() const { return m_len == 0; }
+
+    // Bytes held by the two bitmaps.
+    size_t heap_bytes() const {
+        return (m_present.capacity() + m_value.capacity()) * sizeof(uint64_t);
+    }
+
+    void reserve(size_t additional) {
+        size_t words = word_count(m_len + additional);
+        m_present.reserve(words);
+        m_value.reserve(words);
+    }
+
+    // New elements are None.
+    void resize(size_t len) {
+        size_t words = word_count(len);
+        if (len < m_len && len % 64) {
+            uint64_t keep = (uint64_t(1) << (len % 64)) - 1;
+            m_present[len / 64] &= keep;
+            m_value[len / 64] &= keep;
+        }
+        m_present.resize(words, 0);
+        m_value.resize(words, 0);
+        m_len = len;
+    }
+
+    void push(option::Option<bool> value) {
+        if (m_len % 64 == 0) {
+            m_present.push_back(0);
+            m_value.push_back(0);
+        }
+        ++m_len;
+        set(m_len - 1, value);
+    }
+
+    option::Option<bool> pop() {
+        if (m_len == 0)
+            return {};
+
+        option::Option<bool> ret = get(m_len - 1);
+        resize(m_len - 1);
+        return ret;
+    }
+
+    option::Option<bool> get(size_t idx) const {
+        assert(idx < m_len);
+        uint64_t bit = uint64_t(1) << (idx % 64);
+        if (m_present[idx / 64] & bit)
+            return option::Option<bool>((m_value[idx / 64] & bit) != 0);
+        return {};
+    }
+
+    void set(size_t idx, option::Option<bool> value) {
+        assert(idx < m_len);
+        uint64_t bit = uint64_t(1) << (idx % 64);
+        uint64_t &present = m_present[idx / 64];
+        uint64_t &val = m_value[idx / 64];
+        if (value.is_some()) {
+            present |= bit;
+            if (value.unwrap_unchecked())
+                val |= bit;
+            else
+                val &= ~bit;
+        } else {
+            present &= ~bit;
+            val &= ~bit;
+        }
+    }
+
+    void clear() {
+        m_present.clear();
+        m_value.clear();
+        m_len = 0;
+    }
+
+    // Value bits are kept clear for None so Some(true) is just the value
+    // bitmap, and nothing needs masking.
+    size_t count_some() const { return popcount_all(m_present); }
+
+    size_t count_none() const { return m_len - count_some(); }
+
+    size_t count_true() const { return popcount_all(m_value); }
+
+    size_t count_false() const { return count_some() - count_true(); }
+
+  private:
+    static size_t word_count(size_t len) { return (len + 63) / 64; }
+
+    static size_t popcount(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_popcountll(x));
+#else
+        size_t n = 0;
+        for (; x; x &= x - 1)
+            ++n;
+        return n;
+#endif
+    }
+
+    static size_t popcount_all(const std::vector<uint64_t> &words) {
+        size_t n = 0;
+        for (uint64_t w : words)
+            n += popcount(w);
+        return n;
+    }
+
+    std::vector<uint64_t> m_present;
+    std::vector<uint64_t> m_value;
+    size_t m_len = 0;
+};
+
+} // namespace collections
+} // namespace rustish
+
+#endif //_RUSTISH_COLLECTIONS_OPTION_BOOL_VEC_HPP_
@@ -0,0 +1,149 @@
+#ifndef _RUSTISH_COLLECTIONS_SLICE_HPP_
+#define _RUSTISH_COLLECTIONS_SLICE_HPP_
+
+#include "../option/Option.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace rustish {
+namespace collections {
+
+template <typename T> class Slice;
+
+// Checked element access shared by Slice, Vec and SmallVec, which provide
+// data() and len(). Out of range accesses return None rather than throwing
+// or reading past the end. Each check is a single idx < len() compare, so in
+// a loop bounded by len() the optimizer proves it true and drops it.
+template <typename Derived, typename T> class SliceMethods {
+  public:
+    bool is_empty() const { return self().len() == 0; }
+
+    option::Option<T &> get(size_t idx) {
+        return at(self().data(), self().len(), idx);
+    }
+
+    option::Option<const T &> get(size_t idx) const {
+        return at(cdata(), self().len(), idx);
+    }
+
+    option::Option<T &> first() { return get(0); }
+
+    option::Option<const T &> first() const { return get(0); }
+
+    // len() - 1 wraps around when empty, so last() needs no check of its
+    // own.
+    option::Option<T &> last() { return get(self().len() - 1); }
+
+    option::Option<const T &> last() const { return get(self().len() - 1); }
+
+    // The first element and the rest, or None when empty.
+    option::Option<std::pair<T &, Slice<T>>> split_first() {
+        return split_front(self().data(), self().len());
+    }
+
+    option::Option<std::pair<const T &, Slice<const T>>> split_first() const {
+        return split_front(cdata(), self().len());
+    }
+
+    // The last element and the rest, or None when empty.
+    option::Option<std::pair<T &, Slice<T>>> split_last() {
+        return split_back(self().data(), self().len());
+    }
+
+    option::Option<std::pair<const T &, Slice<const T>>> split_last() const {
+        return split_back(cdata(), self().len());
+    }
+
+    // Unchecked, for indices already known to be in range.
+    T &operator[](size_t idx) {
+        assert(idx < self().len());
+        return self().data()[idx];
+    }
+
+    const T &operator[](size_t idx) const {
+        assert(idx < self().len());
+        return self().data()[idx];
+    }
+
+    T *begin() { return self().data(); }
+    const T *begin() const { return cdata(); }
+
+    T *end() { return self().data() + self().len(); }
+    const T *end() const { return cdata() + self().len(); }
+
+    Slice<T> as_slice() { return Slice<T>(self().data(), self().len()); }
+
+    Slice<const T> as_slice() const {
+        return Slice<const T>(cdata(), self().len());
+    }
+
+  private:
+    Derived &self() { return static_cast<Derived &>(*this); }
+
+    const Derived &self() const { return static_cast<const Derived &>(*this); }
+
+    const T *cdata() const { return self().data(); }
+
+    // The element's address is never null, but the optimizer loses track
+    // of that once it is stored in the Option; saying so lets a following
+    // unwrap() fold away along with the bounds check.
+    template <typename U>
+    static option::Option<U &> at(U *data, size_t len, size_t idx) {
+        if (idx < len) {
+            U *elem = data + idx;
+            RUSTISH_ASSUME(elem != nullptr);
+            return option::Option<U &>(*elem);
+        }
+        return {};
+    }
+
+    template <typename U>
+    static option::Option<std::pair<U &, Slice<U>>> split_front(U *data,
+                                                                size_t len) {
+        if (len == 0)
+            return {};
+        return option::Option<std::pair<U &, Slice<U>>>(
+            option::InPlace(), data[0], Slice<U>(data + 1, len - 1));
+    }
+
+    template <typename U>
+    static option::Option<std::pair<U &, Slice<U>>> split_back(U *data,
+                                                               size_t len) {
+        if (len == 0)
+            return {};
+        return option::Option<std::pair<U &, Slice<U>>>(
+            option::InPlace(), data[len - 1], Slice<U>(data, len - 1));
+    }
+};
+
+// Borrowed view of len contiguous elements, like Rust's &[T]. Slice<const T>
+// is the read-only view.
+template <typename T> class Slice : public SliceMethods<Slice<T>, T> {
+  public:
+    Slice() : m_ptr(nullptr), m_len(0) {}
+
+    Slice(T *ptr, size_t len) : m_ptr(ptr), m_len(len) {}
+
+    // Only adds const or volatile, like std::span: a Slice<Base> over
+    // Derived elements would index with the wrong stride.
+    template <typename U,
+              typename = typename std::enable_if<
+                  std::is_convertible<U (*)[], T (*)[]>::value>::type>
+    Slice(Slice<U> other) : m_ptr(other.data()), m_len(other.len()) {}
+
+    T *data() const { return m_ptr; }
+
+    size_t len() const { return m_len; }
+
+  private:
+    T *m_ptr;
+    size_t m_len;
+};
+
+} // namespace collections
+} // namespace rustish
+
+#endif //_RUSTISH_COLLECTIONS_SLICE_HPP_
@@ -0,0 +1,164 @@
+#ifndef _RUSTISH_COLLECTIONS_SLOT_MAP_HPP_
+#define _RUSTISH_COLLECTIONS_SLOT_MAP_HPP_
+
+#include "../option/Option.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace rustish {
+namespace collections {
+
+// Handle into a SlotMap. The version is bumped every time the slot is freed,
+// so a key that outlives its value no longer matches and lookups return None.
+struct SlotKey {
+    uint32_t index;
+    uint32_t version;
+
+    bool operator==(const SlotKey &other) const {
+        return index == other.index && version == other.version;
+    }
+
+    bool operator!=(const SlotKey &other) const { return !(*this == other); }
+};
+
+// Map from generational keys to values. Values live in one contiguous array
+// (removal swaps the last value into the hole) so iteration is a linear scan.
+// Each key points at a slot which records the value's position; freed slots
+// are chained into an intrusive free list so insert and remove are O(1).
+// Not thread safe.
+template <typename T> class SlotMap {
+    // An odd version means the slot is occupied and dense is the position of
+    // its value. An even version means the slot is free and next_free links
+    // to the next free slot.
+    struct Slot {
+        uint32_t version;
+        union {
+            uint32_t dense;
+            uint32_t next_free;
+        };
+    };
+
+  public:
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    SlotMap() {}
+
+    explicit SlotMap(size_t capacity) { reserve(capacity); }
+
+    size_t len() const { return m_values.size(); }
+
+    bool is_empty() const { return m_values.empty(); }
+
+    size_t capacity() const { return m_values.capacity(); }
+
+    void reserve(size_t additional) {
+        m_values.reserve(m_values.size() + additional);
+        m_owners.reserve(m_owners.size() + additional);
+        m_slots.reserve(m_values.size() + additional);
+    }
+
+    template <typename U, typename V = typename std::enable_if<
+                              option::IsSameDecayType<T, U>::value, void>::type>
+    SlotKey insert(U &&value) {
+        uint32_t idx;
+        if (m_free_head != npos) {
+            idx = m_free_head;
+            m_free_head = m_slots[idx].next_free;
+        } else {
+            idx = static_cast<uint32_t>(m_slots.size());
+            m_slots.push_back(Slot{0, {0}});
+        }
+
+        m_values.push_back(std::forward<U>(value));
+        m_owners.push_back(idx);
+
+        Slot &slot = m_slots[idx];
+        slot.version |= 1;
+        slot.dense = static_cast<uint32_t>(m_values.size() - 1);
+        return SlotKey{idx, slot.version};
+    }
+
+    bool contains_key(SlotKey key) const { return occupied(key); }
+
+    option::Option<T &> get(SlotKey key) {
+        if (occupied(key))
+            return option::Option<T &>(m_values[m_slots[key.index].dense]);
+        return {};
+    }
+
+    option::Option<const T &> get(SlotKey key) const {
+        if (occupied(key))
+            return option::Option<const T &>(
+                m_values[m_slots[key.index].dense]);
+        return {};
+    }
+
+    option::Option<T> remove(SlotKey key) {
+        if (!occupied(key))
+            return {};
+
+        Slot &slot = m_slots[key.index];
+        uint32_t dense = slot.dense;
+        option::Option<T> ret(std::move(m_values[dense]));
+
+        uint32_t last = static_cast<uint32_t>(m_values.size() - 1);
+        if (dense != last) {
+            m_values[dense] = std::move(m_values[last]);
+            m_owners[dense] = m_owners[last];
+            m_slots[m_owners[dense]].dense = dense;
+        }
+        m_values.pop_back();
+        m_owners.pop_back();
+
+        ++slot.version;
+        slot.next_free = m_free_head;
+        m_free_head = key.index;
+        return ret;
+    }
+
+    // Invalidates every outstanding key while keeping the allocations.
+    void clear() {
+        for (uint32_t owner : m_owners) {
+            Slot &slot = m_slots[owner];
+            ++slot.version;
+            slot.next_free = m_free_head;
+            m_free_head = owner;
+        }
+        m_values.clear();
+        m_owners.clear();
+    }
+
+    iterator begin() { return m_values.begin(); }
+    iterator end() { return m_values.end(); }
+    const_iterator begin() const { return m_values.begin(); }
+    const_iterator end() const { return m_values.end(); }
+
+    // Visits every value together with its key, in storage order.
+    template <typename Func> void for_each(Func &&f) {
+        for (size_t i = 0; i < m_values.size(); ++i)
+            f(SlotKey{m_owners[i], m_slots[m_owners[i]].version},
+              m_values[i]);
+    }
+
+  private:
+    static constexpr uint32_t npos = static_cast<uint32_t>(-1);
+
+    bool occupied(SlotKey key) const {
+        return key.index < m_slots.size() &&
+               m_slots[key.index].version == key.version && (key.version & 1);
+    }
+
+    std::vector<T> m_values;
+    std::vector<uint32_t> m_owners;
+    std::vector<Slot> m_slots;
+    uint32_t m_free_head = npos;
+};
+
+} // namespace collections
+} // namespace rustish
+
+#endif //_RUSTISH_COLLECTIONS_SLOT_MAP_HPP_
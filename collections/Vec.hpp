@@ -0,0 +1,219 @@
+#ifndef _RUSTISH_COLLECTIONS_VEC_HPP_
+#define _RUSTISH_COLLECTIONS_VEC_HPP_
+
+#include "../alloc/Global.hpp"
+#include "../option/Option.hpp"
+#include "Slice.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rustish {
+namespace collections {
+
+// Room for N elements inside the SmallVec itself. Empty for N == 0, so that
+// a Vec is just a pointer, a length and a capacity.
+template <typename T, size_t N> class InlineBuffer {
+  protected:
+    T *inline_ptr() const {
+        return reinterpret_cast<T *>(const_cast<unsigned char *>(m_buff));
+    }
+
+  private:
+    alignas(T) unsigned char m_buff[N * sizeof(T)];
+};
+
+template <typename T> class InlineBuffer<T, 0> {
+  protected:
+    T *inline_ptr() const { return nullptr; }
+};
+
+// Growable array that keeps up to N elements inline and moves them to the
+// heap (through the stateless allocation policy Alloc) when it outgrows
+// them. Vec<T> is the N == 0 case. Element access goes through
+// SliceMethods, so get(), first() and last() return Options, and pop()
+// moves the last element out into an Option<T>.
+//
+// The elements are on the heap exactly when capacity() > N. Moving a
+// spilled SmallVec steals its allocation; moving an inline one moves each
+// element. Either way the source is left empty.
+template <typename T, size_t N, typename Alloc = alloc::Global>
+class SmallVec : private InlineBuffer<T, N>,
+                 public SliceMethods<SmallVec<T, N, Alloc>, T> {
+  public:
+    SmallVec() : m_ptr(this->inline_ptr()), m_len(0), m_cap(N) {}
+
+    SmallVec(std::initializer_list<T> init) : SmallVec() {
+        reserve(init.size());
+        for (const T &value : init)
+            new (m_ptr + m_len++) T(value);
+    }
+
+    static SmallVec with_capacity(size_t cap) {
+        SmallVec vec;
+        vec.reserve(cap);
+        return vec;
+    }
+
+    SmallVec(const SmallVec &other) : SmallVec() {
+        reserve(other.m_len);
+        for (const T &value : other)
+            new (m_ptr + m_len++) T(value);
+    }
+
+    SmallVec &operator=(const SmallVec &other) {
+        if (this == &other)
+            return *this;
+
+        clear();
+        reserve(other.m_len);
+        for (const T &value : other)
+            new (m_ptr + m_len++) T(value);
+        return *this;
+    }
+
+    // Only an inline buffer moves element by element.
+    SmallVec(SmallVec &&other) noexcept(
+        N == 0 || std::is_nothrow_move_constructible<T>::value)
+        : SmallVec() {
+        take(other);
+    }
+
+    SmallVec &operator=(SmallVec &&other) noexcept(
+        N == 0 || std::is_nothrow_move_constructible<T>::value) {
+        if (this == &other)
+            return *this;
+
+        clear();
+        release();
+        take(other);
+        return *this;
+    }
+
+    ~SmallVec() {
+        clear();
+        release();
+    }
+
+    size_t len() const { return m_len; }
+
+    size_t capacity() const { return m_cap; }
+
+    // Whether the elements have moved to the heap.
+    bool spilled() const { return m_cap > N; }
+
+    T *data() { return m_ptr; }
+
+    const T *data() const { return m_ptr; }
+
+    void reserve(size_t additional) {
+        if (m_cap - m_len < additional)
+            grow(m_len + additional);
+    }
+
+    void push(T value) {
+        if (m_len == m_cap)
+            grow(m_len + 1);
+        new (m_ptr + m_len) T(std::move(value));
+        ++m_len;
+    }
+
+    // Moves the last element out, or None when empty.
+    option::Option<T> pop() {
+        if (m_len == 0)
+            return {};
+
+        // The element stays counted until it has been moved out, so a
+        // throwing move leaves it to be destroyed with the rest.
+        T *last = m_ptr + m_len - 1;
+        option::Option<T> ret(option::InPlace(), std::move(*last));
+        last->~T();
+        --m_len;
+        return ret;
+    }
+
+    // Drops the elements from len on; does nothing if len >= len().
+    void truncate(size_t len) {
+        while (m_len > len)
+            m_ptr[--m_len].~T();
+    }
+
+    // Keeps the capacity, including any heap allocation.
+    void clear() { truncate(0); }
+
+  private:
+    static constexpr bool trivial = std::is_trivially_copyable<T>::value;
+
+    // At least doubles, so that push() is amortised O(1).
+    void grow(size_t needed) {
+        size_t cap = std::max(needed, std::max(m_cap * 2, size_t(4)));
+        T *ptr =
+            static_cast<T *>(Alloc::allocate(cap * sizeof(T), alignof(T)));
+
+        if (trivial) {
+            if (m_len)
+                std::memcpy(static_cast<void *>(ptr), m_ptr, m_len * sizeof(T));
+        } else {
+            size_t i = 0;
+            try {
+                for (; i < m_len; ++i)
+                    new (ptr + i) T(std::move_if_noexcept(m_ptr[i]));
+            } catch (...) {
+                while (i)
+                    ptr[--i].~T();
+                Alloc::deallocate(ptr, cap * sizeof(T), alignof(T));
+                throw;
+            }
+            for (i = 0; i < m_len; ++i)
+                m_ptr[i].~T();
+        }
+
+        release();
+        m_ptr = ptr;
+        m_cap = cap;
+    }
+
+    // Frees the heap allocation, if any. The elements must be gone already.
+    void release() {
+        if (spilled())
+            Alloc::deallocate(m_ptr, m_cap * sizeof(T), alignof(T));
+        m_ptr = this->inline_ptr();
+        m_cap = N;
+    }
+
+    // Takes other's elements; *this must be empty and inline.
+    void take(SmallVec &other) {
+        if (other.spilled()) {
+            m_ptr = other.m_ptr;
+            m_len = other.m_len;
+            m_cap = other.m_cap;
+            other.m_ptr = other.inline_ptr();
+            other.m_len = 0;
+            other.m_cap = N;
+            return;
+        }
+
+        for (; m_len < other.m_len; ++m_len)
+            new (m_ptr + m_len) T(std::move(other.m_ptr[m_len]));
+        other.clear();
+    }
+
+    T *m_ptr;
+    size_t m_len;
+    size_t m_cap;
+};
+
+// Growable array that always keeps its elements on the heap, like Rust's
+// Vec<T>.
+template <typename T, typename Alloc = alloc::Global>
+using Vec = SmallVec<T, 0, Alloc>;
+
+} // namespace collections
+} // namespace rustish
+
+#endif //_RUSTISH_COLLECTIONS_VEC_HPP_
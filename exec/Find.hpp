@@ -0,0 +1,116 @@
+#ifndef _RUSTISH_EXEC_FIND_HPP_
+#define _RUSTISH_EXEC_FIND_HPP_
+
+#include "../option/Option.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace rustish {
+namespace exec {
+
+namespace detail {
+
+// Workers poll for cancellation once per block rather than per element so
+// the inner loop stays tight.
+constexpr size_t find_block = 1024;
+
+template <typename F>
+using FindResult = typename std::result_of<F(size_t)>::type;
+
+// Shared state of one search. limit is the first index that no longer
+// needs to be searched: end for no hit yet, 0 once find_map_any has a hit,
+// the hit index for find_map_first.
+template <typename Opt> struct FindState {
+    explicit FindState(size_t end) : limit(end) {}
+
+    std::atomic<size_t> limit;
+    std::mutex mutex;
+    Opt result;
+};
+
+template <typename F, typename Opt>
+void find_range(size_t begin, size_t end, F &f, FindState<Opt> &state,
+                bool first) {
+    for (size_t block = begin; block < end; block += find_block) {
+        size_t block_end = std::min(end, block + find_block);
+        if (block >= state.limit.load(std::memory_order_relaxed))
+            return;
+
+        for (size_t i = block; i < block_end; ++i) {
+            Opt found = f(i);
+            if (found.is_none())
+                continue;
+
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (i < state.limit.load(std::memory_order_relaxed)) {
+                state.result = std::move(found);
+                state.limit.store(first ? i : 0, std::memory_order_relaxed);
+            }
+            return;
+        }
+    }
+}
+
+template <typename F, typename Opt>
+void find_split(ThreadPool &pool, size_t begin, size_t end, size_t grain,
+                F &f, FindState<Opt> &state, bool first) {
+    if (begin >= state.limit.load(std::memory_order_relaxed))
+        return;
+    if (end - begin <= grain) {
+        find_range(begin, end, f, state, first);
+        return;
+    }
+
+    size_t mid = begin + (end - begin) / 2;
+    pool.join([&] { find_split(pool, begin, mid, grain, f, state, first); },
+              [&] { find_split(pool, mid, end, grain, f, state, first); });
+}
+
+template <typename F>
+FindResult<F> find_map(ThreadPool &pool, size_t begin, size_t end, F &f,
+                       bool first) {
+    using Opt = FindResult<F>;
+    if (begin >= end)
+        return {};
+
+    // Enough pieces for stealing to balance uneven costs, but not so many
+    // that splitting dominates.
+    size_t pieces = pool.num_threads() * 16;
+    size_t grain = std::max((end - begin) / pieces, find_block);
+
+    FindState<Opt> state(end);
+    pool.install(
+        [&] { find_split(pool, begin, end, grain, f, state, first); });
+    return std::move(state.result);
+}
+
+} // namespace detail
+
+// Calls f(i) for indices in [begin, end) across the pool and returns any
+// one Some result, or None. Workers stop soon after a hit is found. f must
+// be safe to call concurrently and return an Option.
+template <typename F>
+detail::FindResult<F> find_map_any(ThreadPool &pool, size_t begin, size_t end,
+                                   F f) {
+    return detail::find_map(pool, begin, end, f, false);
+}
+
+// Like find_map_any, but returns the result for the lowest index that
+// gives Some. Work above the best hit so far is skipped, work below it
+// continues.
+template <typename F>
+detail::FindResult<F> find_map_first(ThreadPool &pool, size_t begin,
+                                     size_t end, F f) {
+    return detail::find_map(pool, begin, end, f, true);
+}
+
+} // namespace exec
+} // namespace rustish
+
+#endif //_RUSTISH_EXEC_FIND_HPP_
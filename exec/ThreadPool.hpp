@@ -0,0 +1,342 @@
+#ifndef _RUSTISH_EXEC_THREAD_POOL_HPP_
+#define _RUSTISH_EXEC_THREAD_POOL_HPP_
+
+#include "../boxed/Box.hpp"
+#include "../option/Option.hpp"
+#include "../sync/ChaseLevDeque.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rustish {
+namespace exec {
+
+// Unit of work handed between threads. Jobs must not throw.
+struct Job {
+    virtual void execute() = 0;
+
+  protected:
+    ~Job() = default;
+};
+
+namespace detail {
+
+// Owns itself; deleted after running.
+template <typename F> struct HeapJob final : Job {
+    explicit HeapJob(F &&f) : func(std::move(f)) {}
+
+    void execute() override {
+        F f(std::move(func));
+        delete this;
+        f();
+    }
+
+    F func;
+};
+
+// Lives on the stack of a thread inside join(), which spins or helps
+// until done is set.
+template <typename F> struct StackJob final : Job {
+    explicit StackJob(F &f) : func(f) {}
+
+    void execute() override {
+        func();
+        done.store(true, std::memory_order_release);
+    }
+
+    F &func;
+    std::atomic<bool> done{false};
+};
+
+// Lives on the stack of a thread outside the pool, which sleeps until set.
+template <typename F> struct LatchJob final : Job {
+    explicit LatchJob(F &f) : func(f) {}
+
+    void execute() override {
+        func();
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+        cv.notify_one();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return done; });
+    }
+
+    F &func;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+};
+
+} // namespace detail
+
+// Work-stealing thread pool. Each worker owns a Chase-Lev deque: it pushes
+// and pops its own jobs at the bottom while idle workers steal from the
+// top. Jobs submitted from outside the pool go through a shared injector
+// queue. Workers with nothing to do park on a condition variable and are
+// woken when new work is published.
+class ThreadPool {
+    struct Worker {
+        ThreadPool *pool;
+        size_t index;
+        uint64_t rng;
+        sync::ChaseLevDeque<Job *> deque;
+        std::thread thread;
+    };
+
+  public:
+    explicit ThreadPool(size_t threads = std::thread::hardware_concurrency()) {
+        if (threads == 0)
+            threads = 1;
+        // Workers hold cache line aligned deques; Box allocates them with
+        // the right alignment before C++17 too.
+        for (size_t i = 0; i < threads; ++i) {
+            m_workers.push_back(boxed::Box<Worker>::new_());
+            m_workers.back()->pool = this;
+            m_workers.back()->index = i;
+            m_workers.back()->rng = 0x9E3779B97F4A7C15ull * (i + 1);
+        }
+        for (boxed::Box<Worker> &w : m_workers)
+            w->thread = std::thread(&ThreadPool::run_worker, this, w.as_ptr());
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // Runs every job still queued, then stops the workers.
+    ~ThreadPool() {
+        m_stop.store(true, std::memory_order_seq_cst);
+        {
+            std::lock_guard<std::mutex> lock(m_sleep_mutex);
+            m_sleep_cv.notify_all();
+        }
+        for (boxed::Box<Worker> &w : m_workers)
+            w->thread.join();
+    }
+
+    size_t num_threads() const { return m_workers.size(); }
+
+    // Index of the calling worker of this pool, or None outside it.
+    option::Option<size_t> current_index() const {
+        Worker *w = current();
+        if (w && w->pool == this)
+            return option::Option<size_t>(w->index);
+        return {};
+    }
+
+    // Runs f asynchronously. Pending jobs are finished before the pool is
+    // destroyed.
+    template <typename F> void spawn(F f) {
+        publish(new detail::HeapJob<F>(std::move(f)));
+    }
+
+    // Runs f on a worker and waits for it. Called from a worker, f runs
+    // inline.
+    template <typename F> void install(F f) {
+        if (local_worker()) {
+            f();
+            return;
+        }
+
+        detail::LatchJob<F> job(f);
+        inject(&job);
+        job.wait();
+    }
+
+    // Runs a and b, potentially in parallel, and returns when both are
+    // done. b is offered to thieves while the caller runs a.
+    template <typename A, typename B> void join(A a, B b) {
+        Worker *w = local_worker();
+        if (!w) {
+            install([&] { join(a, b); });
+            return;
+        }
+
+        detail::StackJob<B> job_b(b);
+        w->deque.push(&job_b);
+        notify();
+        a();
+
+        while (!job_b.done.load(std::memory_order_acquire)) {
+            option::Option<Job *> job = w->deque.pop();
+            if (job.is_none())
+                job = steal(*w);
+            if (job.is_some())
+                job.unwrap()->execute();
+            else
+                std::this_thread::yield();
+        }
+    }
+
+    // Calls body(lo, hi) over disjoint subranges of [begin, end) no larger
+    // than grain, splitting in halves with join so idle workers steal the
+    // largest remaining pieces.
+    template <typename F>
+    void parallel_for(size_t begin, size_t end, size_t grain, F body) {
+        if (grain == 0)
+            grain = 1;
+        install([&] { split(begin, end, grain, body); });
+    }
+
+  private:
+    static Worker *&current() {
+        static thread_local Worker *worker = nullptr;
+        return worker;
+    }
+
+    Worker *local_worker() const {
+        Worker *w = current();
+        return w && w->pool == this ? w : nullptr;
+    }
+
+    template <typename F>
+    void split(size_t begin, size_t end, size_t grain, F &body) {
+        if (end - begin <= grain) {
+            body(begin, end);
+            return;
+        }
+        size_t mid = begin + (end - begin) / 2;
+        join([&] { split(begin, mid, grain, body); },
+             [&] { split(mid, end, grain, body); });
+    }
+
+    void publish(Job *job) {
+        Worker *w = local_worker();
+        if (w) {
+            w->deque.push(job);
+            notify();
+        } else {
+            inject(job);
+        }
+    }
+
+    void inject(Job *job) {
+        {
+            std::lock_guard<std::mutex> lock(m_injector_mutex);
+            m_injector.push_back(job);
+            m_injected.fetch_add(1, std::memory_order_release);
+        }
+        notify();
+    }
+
+    option::Option<Job *> pop_injected() {
+        if (m_injected.load(std::memory_order_acquire) == 0)
+            return {};
+
+        std::lock_guard<std::mutex> lock(m_injector_mutex);
+        if (m_injector.empty())
+            return {};
+        Job *job = m_injector.front();
+        m_injector.pop_front();
+        m_injected.fetch_sub(1, std::memory_order_relaxed);
+        return option::Option<Job *>(job);
+    }
+
+    // Injector first, then every other worker starting at a random one.
+    option::Option<Job *> steal(Worker &self) {
+        option::Option<Job *> job = pop_injected();
+        if (job.is_some())
+            return job;
+
+        size_t n = m_workers.size();
+        self.rng ^= self.rng << 13;
+        self.rng ^= self.rng >> 7;
+        self.rng ^= self.rng << 17;
+        size_t start = size_t(self.rng % n);
+        for (size_t i = 0; i < n; ++i) {
+            Worker &victim = *m_workers[(start + i) % n];
+            if (&victim == &self)
+                continue;
+            job = victim.deque.steal();
+            if (job.is_some())
+                return job;
+        }
+        return {};
+    }
+
+    option::Option<Job *> find_work(Worker &self) {
+        option::Option<Job *> job = self.deque.pop();
+        if (job.is_some())
+            return job;
+        return steal(self);
+    }
+
+    // Publishing a job and going to sleep both fence before checking the
+    // other side, so either the sleeper sees the job or the publisher sees
+    // the sleeper.
+    void notify() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_sleepers.load(std::memory_order_relaxed) == 0)
+            return;
+        m_epoch.fetch_add(1, std::memory_order_seq_cst);
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_sleep_cv.notify_one();
+    }
+
+    void run_worker(Worker *self) {
+        current() = self;
+        const int spin_limit = 32;
+        int idle = 0;
+        for (;;) {
+            option::Option<Job *> job = find_work(*self);
+            if (job.is_some()) {
+                job.unwrap()->execute();
+                idle = 0;
+                continue;
+            }
+            if (m_stop.load(std::memory_order_acquire))
+                break;
+            if (++idle < spin_limit) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            uint64_t seen = m_epoch.load(std::memory_order_seq_cst);
+            job = find_work(*self);
+            if (job.is_some()) {
+                m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+                job.unwrap()->execute();
+                idle = 0;
+                continue;
+            }
+            {
+                std::unique_lock<std::mutex> lock(m_sleep_mutex);
+                m_sleep_cv.wait(lock, [&] {
+                    return m_epoch.load(std::memory_order_seq_cst) != seen ||
+                           m_stop.load(std::memory_order_seq_cst);
+                });
+            }
+            m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+            idle = 0;
+        }
+        current() = nullptr;
+    }
+
+    std::vector<boxed::Box<Worker>> m_workers;
+
+    std::mutex m_injector_mutex;
+    std::deque<Job *> m_injector;
+    std::atomic<size_t> m_injected{0};
+
+    std::atomic<bool> m_stop{false};
+    std::atomic<size_t> m_sleepers{0};
+    std::atomic<uint64_t> m_epoch{0};
+    std::mutex m_sleep_mutex;
+    std::condition_variable m_sleep_cv;
+};
+
+} // namespace exec
+} // namespace rustish
+
+#endif //_RUSTISH_EXEC_THREAD_POOL_HPP_
@@ -0,0 +1,331 @@
+#ifndef _RUSTISH_IO_COLUMN_FILE_HPP_
+#define _RUSTISH_IO_COLUMN_FILE_HPP_
+
+#include "../option/Option.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rustish {
+namespace io {
+
+// On-disk layout of a nullable column of trivially copyable T, designed to
+// be mmap()ed and read in place:
+//
+//   Header (64 bytes)
+//   Block 0: validity bitmap (block_len bits) | block_len values
+//   Block 1: ...
+//
+// Blocks are fixed size and 64 byte aligned, so element i lives at a
+// computable offset and the file can grow by appending to the last block.
+// Values are stored in host byte order; the header's byte_order field
+// rejects files written on a machine of the other endianness.
+struct ColumnHeader {
+    static constexpr uint64_t magic_value = 0x4C4F43485355520Aull;
+    static constexpr uint32_t current_version = 1;
+    static constexpr uint32_t byte_order_value = 0x01020304;
+    static constexpr uint32_t default_block_len = 4096;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t value_size;
+    uint32_t value_align;
+    uint32_t block_len;
+    uint32_t reserved0;
+    uint64_t count;
+    uint64_t reserved[3];
+
+    uint64_t bitmap_bytes() const { return block_len / 8; }
+
+    uint64_t block_bytes() const {
+        return bitmap_bytes() + uint64_t(block_len) * value_size;
+    }
+
+    uint64_t block_offset(uint64_t block) const {
+        return sizeof(ColumnHeader) + block * block_bytes();
+    }
+
+    // File size needed to hold count elements.
+    uint64_t file_size() const {
+        if (count == 0)
+            return sizeof(ColumnHeader);
+        uint64_t last = (count - 1) / block_len;
+        uint64_t in_last = count - last * block_len;
+        return block_offset(last) + bitmap_bytes() + in_last * value_size;
+    }
+
+    template <typename T> static ColumnHeader for_type() {
+        ColumnHeader h;
+        std::memset(&h, 0, sizeof(h));
+        h.magic = magic_value;
+        h.version = current_version;
+        h.byte_order = byte_order_value;
+        h.value_size = sizeof(T);
+        h.value_align = alignof(T);
+        h.block_len = default_block_len;
+        h.count = 0;
+        return h;
+    }
+
+    template <typename T> bool matches() const {
+        return magic == magic_value && version == current_version &&
+               byte_order == byte_order_value && value_size == sizeof(T) &&
+               value_align == alignof(T) && block_len % 512 == 0 &&
+               block_len != 0;
+    }
+};
+
+static_assert(sizeof(ColumnHeader) == 64, "ColumnHeader must be 64 bytes");
+
+// Read-only view of a column file mapped into memory. Opening validates the
+// header and size only; elements are read straight from the mapping. The
+// header is copied when it is validated, so a writer appending to the file
+// meanwhile cannot raise len() past the mapped size.
+template <typename T> class MappedColumn {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "MappedColumn requires a trivially copyable type");
+    static_assert(alignof(T) <= 64, "MappedColumn supports alignment <= 64");
+
+  public:
+    static option::Option<MappedColumn> open(const std::string &path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return {};
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0 ||
+            static_cast<uint64_t>(st.st_size) < sizeof(ColumnHeader)) {
+            ::close(fd);
+            return {};
+        }
+
+        size_t size = static_cast<size_t>(st.st_size);
+        void *map = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (map == MAP_FAILED)
+            return {};
+
+        MappedColumn column(static_cast<const uint8_t *>(map), size);
+        const ColumnHeader &h = column.m_header;
+        if (!h.template matches<T>() || h.file_size() > size)
+            return {};
+        return option::Option<MappedColumn>(std::move(column));
+    }
+
+    MappedColumn(const MappedColumn &) = delete;
+    MappedColumn &operator=(const MappedColumn &) = delete;
+
+    MappedColumn(MappedColumn &&other)
+        : m_base(other.m_base), m_size(other.m_size),
+          m_header(other.m_header) {
+        other.m_base = nullptr;
+        other.m_size = 0;
+    }
+
+    MappedColumn &operator=(MappedColumn &&other) {
+        if (this == &other)
+            return *this;
+
+        unmap();
+        m_base = other.m_base;
+        m_size = other.m_size;
+        m_header = other.m_header;
+        other.m_base = nullptr;
+        other.m_size = 0;
+        return *this;
+    }
+
+    ~MappedColumn() { unmap(); }
+
+    size_t len() const { return static_cast<size_t>(header().count); }
+
+    bool is_empty() const { return len() == 0; }
+
+    // idx must be < len().
+    bool is_some(size_t idx) const {
+        const ColumnHeader &h = header();
+        const uint8_t *block = m_base + h.block_offset(idx / h.block_len);
+        size_t bit = idx % h.block_len;
+        return (block[bit / 8] >> (bit % 8)) & 1;
+    }
+
+    // idx must be < len().
+    option::Option<const T &> get(size_t idx) const {
+        if (!is_some(idx))
+            return {};
+
+        const ColumnHeader &h = header();
+        const uint8_t *block = m_base + h.block_offset(idx / h.block_len);
+        const uint8_t *value =
+            block + h.bitmap_bytes() + (idx % h.block_len) * sizeof(T);
+        return option::Option<const T &>(
+            *reinterpret_cast<const T *>(value));
+    }
+
+    // The header as it was when the column was opened.
+    const ColumnHeader &header() const { return m_header; }
+
+  private:
+    MappedColumn(const uint8_t *base, size_t size)
+        : m_base(base), m_size(size) {
+        std::memcpy(&m_header, base, sizeof(m_header));
+    }
+
+    void unmap() {
+        if (m_base)
+            ::munmap(const_cast<uint8_t *>(m_base), m_size);
+        m_base = nullptr;
+    }
+
+    const uint8_t *m_base;
+    size_t m_size;
+    ColumnHeader m_header;
+};
+
+// Append-only writer for column files. Elements are buffered one block at
+// a time; flush() writes the pending block and then the header, so a reader
+// only ever sees a count covering data that is already on disk.
+template <typename T> class ColumnWriter {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "ColumnWriter requires a trivially copyable type");
+
+  public:
+    // Creates (or truncates) path.
+    static option::Option<ColumnWriter> create(const std::string &path) {
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0)
+            return {};
+
+        ColumnWriter writer(fd, ColumnHeader::for_type<T>());
+        if (!writer.write_header())
+            return {};
+        return option::Option<ColumnWriter>(std::move(writer));
+    }
+
+    // Opens an existing column file to add more elements.
+    static option::Option<ColumnWriter> append(const std::string &path) {
+        int fd = ::open(path.c_str(), O_RDWR);
+        if (fd < 0)
+            return {};
+
+        ColumnHeader h;
+        if (::pread(fd, &h, sizeof(h), 0) !=
+                static_cast<ssize_t>(sizeof(h)) ||
+            !h.template matches<T>()) {
+            ::close(fd);
+            return {};
+        }
+
+        ColumnWriter writer(fd, h);
+        size_t in_block = static_cast<size_t>(h.count % h.block_len);
+        writer.m_flushed = h.count - in_block;
+        writer.m_in_block = in_block;
+        if (in_block) {
+            // Reload the partial last block so it can keep growing.
+            uint64_t block = h.count / h.block_len;
+            size_t bytes = h.bitmap_bytes() + in_block * sizeof(T);
+            if (::pread(fd, writer.m_block.data(), bytes,
+                        h.block_offset(block)) !=
+                static_cast<ssize_t>(bytes)) {
+                // Truncated file: close without rewriting the header.
+                ::close(fd);
+                writer.m_fd = -1;
+                return {};
+            }
+        }
+        return option::Option<ColumnWriter>(std::move(writer));
+    }
+
+    ColumnWriter(const ColumnWriter &) = delete;
+    ColumnWriter &operator=(const ColumnWriter &) = delete;
+
+    ColumnWriter(ColumnWriter &&other)
+        : m_fd(other.m_fd), m_header(other.m_header),
+          m_block(std::move(other.m_block)), m_flushed(other.m_flushed),
+          m_in_block(other.m_in_block) {
+        other.m_fd = -1;
+    }
+
+    ColumnWriter &operator=(ColumnWriter &&) = delete;
+
+    // Flushes pending elements; errors at this point are lost, so call
+    // flush() explicitly when they matter.
+    ~ColumnWriter() {
+        if (m_fd >= 0) {
+            flush();
+            ::close(m_fd);
+        }
+    }
+
+    size_t len() const { return static_cast<size_t>(m_flushed + m_in_block); }
+
+    // Returns false if a completed block could not be written.
+    bool push(const option::Option<T> &value) {
+        uint8_t *bitmap = m_block.data();
+        size_t bit = m_in_block;
+        if (value.is_some()) {
+            bitmap[bit / 8] |= static_cast<uint8_t>(1 << (bit % 8));
+            const T &v = value.as_ref().unwrap();
+            std::memcpy(values() + bit * sizeof(T), &v, sizeof(T));
+        } else {
+            bitmap[bit / 8] &= static_cast<uint8_t>(~(1 << (bit % 8)));
+            std::memset(values() + bit * sizeof(T), 0, sizeof(T));
+        }
+
+        if (++m_in_block < m_header.block_len)
+            return true;
+
+        bool ok = flush();
+        m_flushed += m_in_block;
+        m_in_block = 0;
+        std::memset(m_block.data(), 0, m_header.bitmap_bytes());
+        return ok;
+    }
+
+    // Writes the pending block, then the header with the new count.
+    bool flush() {
+        uint64_t block = m_flushed / m_header.block_len;
+        size_t bytes = m_header.bitmap_bytes() + m_in_block * sizeof(T);
+        if (m_in_block &&
+            ::pwrite(m_fd, m_block.data(), bytes,
+                     m_header.block_offset(block)) !=
+                static_cast<ssize_t>(bytes))
+            return false;
+
+        m_header.count = m_flushed + m_in_block;
+        return write_header();
+    }
+
+  private:
+    ColumnWriter(int fd, const ColumnHeader &header)
+        : m_fd(fd), m_header(header),
+          m_block(static_cast<size_t>(header.block_bytes()), 0) {}
+
+    uint8_t *values() { return m_block.data() + m_header.bitmap_bytes(); }
+
+    bool write_header() {
+        return ::pwrite(m_fd, &m_header, sizeof(m_header), 0) ==
+               static_cast<ssize_t>(sizeof(m_header));
+    }
+
+    int m_fd;
+    ColumnHeader m_header;
+    std::vector<uint8_t> m_block;
+    uint64_t m_flushed = 0;
+    size_t m_in_block = 0;
+};
+
+} // namespace io
+} // namespace rustish
+
+#endif //_RUSTISH_IO_COLUMN_FILE_HPP_
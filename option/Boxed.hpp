@@ -0,0 +1,155 @@
+#ifndef _RUSTISH_OPTION_BOXED_HPP_
+#define _RUSTISH_OPTION_BOXED_HPP_
+
+#include "../alloc/ThreadCache.hpp"
+#include "Option.hpp"
+
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace rustish {
+namespace option {
+
+// Large payloads that are rarely present opt in to boxed storage by
+// specialising BoxedPayload, deriving from BoxedIn:
+//   template <> struct BoxedPayload<DebugBlock> : BoxedIn<> {};
+// Option<DebugBlock> then holds only a pointer to a heap allocated payload,
+// with null as None, and keeps the full Option API. Alloc is a stateless
+// allocation policy; the default recycles blocks through per-thread free
+// lists. The specialisation must be visible wherever Option<T> is used.
+template <typename T> struct BoxedPayload {
+    static constexpr bool available = false;
+};
+
+// The rustish library compiles Option<T> once for each of
+// RUSTISH_OPTION_COMMON_PAYLOADS with inline storage, and other TUs link
+// against those instantiations. Boxing one of them would quietly keep the
+// inline layout in some TUs and not others, so these are specialised here
+// and a second specialisation is a redefinition error.
+#define RUSTISH_OPTION_NOT_BOXED(T)                                            \
+    template <> struct BoxedPayload<T> {                                       \
+        static constexpr bool available = false;                               \
+    };
+
+RUSTISH_OPTION_COMMON_PAYLOADS(RUSTISH_OPTION_NOT_BOXED)
+
+#undef RUSTISH_OPTION_NOT_BOXED
+
+template <typename Alloc = alloc::ThreadCache> struct BoxedIn {
+    static constexpr bool available = true;
+    using alloc = Alloc;
+};
+
+template <typename T>
+class OptionStorage<T,
+                    typename std::enable_if<BoxedPayload<T>::available>::type> {
+    static_assert(!NicheTraits<T>::available,
+                  "a payload cannot be both boxed and niche packed");
+
+    using Alloc = typename BoxedPayload<T>::alloc;
+
+  public:
+    using ret_t = T;
+    using ref_t = T &;
+    using cref_t = const T &;
+    using param_t = T;
+
+    static constexpr bool determinate = false;
+
+    OptionStorage() : m_ptr(nullptr) {}
+
+    template <typename... Args>
+    explicit OptionStorage(InPlace, Args &&...args)
+        : m_ptr(construct(Alloc::allocate(sizeof(T), alignof(T)),
+                          std::forward<Args>(args)...)) {}
+
+    OptionStorage(const OptionStorage &other) : m_ptr(nullptr) {
+        if (other.is_some())
+            m_ptr = construct(Alloc::allocate(sizeof(T), alignof(T)),
+                              other.cref());
+    }
+
+    OptionStorage &operator=(const OptionStorage &other) {
+        if (this == &other)
+            return *this;
+
+        if (other.is_some())
+            emplace(other.cref());
+        else
+            reset();
+        return *this;
+    }
+
+    // Moving hands over the allocation; the payload itself stays put.
+    OptionStorage(OptionStorage &&other) : m_ptr(other.m_ptr) {
+        other.m_ptr = nullptr;
+    }
+
+    OptionStorage &operator=(OptionStorage &&other) {
+        if (this == &other)
+            return *this;
+
+        reset();
+        m_ptr = other.m_ptr;
+        other.m_ptr = nullptr;
+        return *this;
+    }
+
+    ~OptionStorage() { reset(); }
+
+    // Reuses the current allocation when there is one. If constructing the
+    // new payload throws, the Option is left None.
+    template <typename... Args> void emplace(Args &&...args) {
+        void *mem;
+        if (m_ptr) {
+            m_ptr->~T();
+            mem = m_ptr;
+            m_ptr = nullptr;
+        } else {
+            mem = Alloc::allocate(sizeof(T), alignof(T));
+        }
+        m_ptr = construct(mem, std::forward<Args>(args)...);
+    }
+
+    bool is_some() const { return m_ptr != nullptr; }
+
+    bool is_none() const { return m_ptr == nullptr; }
+
+    T get() {
+        T ret(std::move(*m_ptr));
+        reset();
+        return ret;
+    }
+
+    T &ref() { return *m_ptr; }
+
+    const T &cref() const { return *m_ptr; }
+
+  private:
+    template <typename... Args> static T *construct(void *mem, Args &&...args) {
+        try {
+            return new (mem) T(std::forward<Args>(args)...);
+        } catch (...) {
+            Alloc::deallocate(mem, sizeof(T), alignof(T));
+            throw;
+        }
+    }
+
+    void reset() {
+        if (m_ptr) {
+            m_ptr->~T();
+            Alloc::deallocate(m_ptr, sizeof(T), alignof(T));
+            m_ptr = nullptr;
+        }
+    }
+
+    T *m_ptr;
+};
+
+} // namespace option
+} // namespace rustish
+
+#endif //_RUSTISH_OPTION_BOXED_HPP_
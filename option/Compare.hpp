@@ -0,0 +1,319 @@
+#ifndef _RUSTISH_OPTION_COMPARE_HPP_
+#define _RUSTISH_OPTION_COMPARE_HPP_
+
+// Included from Option.hpp; include that instead.
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+#if defined(__cpp_impl_three_way_comparison) &&                                \
+    __cpp_impl_three_way_comparison >= 201907L && __has_include(<compare>)
+#include <compare>
+#define RUSTISH_HAS_THREE_WAY 1
+#else
+#define RUSTISH_HAS_THREE_WAY 0
+#endif
+
+namespace rustish {
+namespace option {
+
+template <typename T> struct IsOption : std::false_type {};
+template <typename T> struct IsOption<Option<T>> : std::true_type {};
+
+// Values an Option is compared against directly, i.e. anything other than
+// an Option or None.
+template <typename U> struct IsPlainOperand {
+    using D = typename std::decay<U>::type;
+    static constexpr bool value =
+        !IsOption<D>::value && !std::is_same<D, None>::value;
+};
+
+// Comparisons order None before every Some, as in Rust. When both payloads
+// have determinate storage the values are read unconditionally and combined
+// with the tags using bitwise operations, so there is no branch to
+// mispredict.
+struct OptionCompare {
+    template <typename T>
+    static typename OptionStorage<T>::cref_t value(const Option<T> &opt) {
+        return opt.m_storage.cref();
+    }
+
+    template <typename T, typename U> struct Determinate {
+        static constexpr bool value = OptionStorage<T>::determinate &&
+                                      OptionStorage<U>::determinate;
+    };
+
+    template <typename T, typename U>
+    static bool eq(const Option<T> &a, const Option<U> &b, std::true_type) {
+        bool sa = a.is_some(), sb = b.is_some();
+        return (sa == sb) & (!sa | (value(a) == value(b)));
+    }
+
+    template <typename T, typename U>
+    static bool eq(const Option<T> &a, const Option<U> &b, std::false_type) {
+        if (a.is_some() != b.is_some())
+            return false;
+        return a.is_none() || a.m_storage.cref() == b.m_storage.cref();
+    }
+
+    template <typename T, typename U>
+    static bool lt(const Option<T> &a, const Option<U> &b, std::true_type) {
+        bool sa = a.is_some(), sb = b.is_some();
+        return (sa < sb) | (sa & sb & (value(a) < value(b)));
+    }
+
+    template <typename T, typename U>
+    static bool lt(const Option<T> &a, const Option<U> &b, std::false_type) {
+        if (a.is_none() || b.is_none())
+            return a.is_none() && b.is_some();
+        return a.m_storage.cref() < b.m_storage.cref();
+    }
+
+    template <typename T, typename U>
+    static bool eq(const Option<T> &a, const Option<U> &b) {
+        return eq(a, b,
+                  std::integral_constant<bool, Determinate<T, U>::value>());
+    }
+
+    template <typename T, typename U>
+    static bool lt(const Option<T> &a, const Option<U> &b) {
+        return lt(a, b,
+                  std::integral_constant<bool, Determinate<T, U>::value>());
+    }
+
+    template <typename T, typename U>
+    static bool eq_value(const Option<T> &a, const U &b) {
+        if (OptionStorage<T>::determinate)
+            return a.is_some() & (value(a) == b);
+        return a.is_some() && a.m_storage.cref() == b;
+    }
+
+    template <typename T, typename U>
+    static bool lt_value(const Option<T> &a, const U &b) {
+        if (OptionStorage<T>::determinate)
+            return a.is_none() | (value(a) < b);
+        return a.is_none() || a.m_storage.cref() < b;
+    }
+
+    template <typename T, typename U>
+    static bool gt_value(const Option<T> &a, const U &b) {
+        if (OptionStorage<T>::determinate)
+            return a.is_some() & (b < value(a));
+        return a.is_some() && b < a.m_storage.cref();
+    }
+
+#if RUSTISH_HAS_THREE_WAY
+    template <typename T, typename U>
+    static auto cmp(const Option<T> &a, const Option<U> &b)
+        -> std::compare_three_way_result_t<typename std::decay<T>::type,
+                                           typename std::decay<U>::type> {
+        if (a.is_some() && b.is_some())
+            return a.m_storage.cref() <=> b.m_storage.cref();
+        return a.is_some() <=> b.is_some();
+    }
+
+    template <typename T, typename U>
+    static auto cmp_value(const Option<T> &a, const U &b)
+        -> std::compare_three_way_result_t<typename std::decay<T>::type, U> {
+        if (a.is_some())
+            return a.m_storage.cref() <=> b;
+        return std::strong_ordering::less;
+    }
+#endif
+
+    template <typename T> static size_t hash(const Option<T> &opt) {
+        using H = std::hash<typename std::decay<T>::type>;
+        // None hashes to zero and every Some is offset so that Some of a
+        // value hashing to zero does not collide with it.
+        const size_t offset = static_cast<size_t>(0x9E3779B97F4A7C15ull);
+        size_t mask = size_t(0) - static_cast<size_t>(opt.is_some());
+        if (OptionStorage<T>::determinate)
+            return (H()(value(opt)) + offset) & mask;
+        return opt.is_some() ? H()(opt.m_storage.cref()) + offset : 0;
+    }
+};
+
+template <typename T, typename U>
+inline bool operator==(const Option<T> &a, const Option<U> &b) {
+    return OptionCompare::eq(a, b);
+}
+
+template <typename T, typename U>
+inline bool operator!=(const Option<T> &a, const Option<U> &b) {
+    return !OptionCompare::eq(a, b);
+}
+
+template <typename T, typename U>
+inline bool operator<(const Option<T> &a, const Option<U> &b) {
+    return OptionCompare::lt(a, b);
+}
+
+template <typename T, typename U>
+inline bool operator>(const Option<T> &a, const Option<U> &b) {
+    return OptionCompare::lt(b, a);
+}
+
+template <typename T, typename U>
+inline bool operator<=(const Option<T> &a, const Option<U> &b) {
+    return !OptionCompare::lt(b, a);
+}
+
+template <typename T, typename U>
+inline bool operator>=(const Option<T> &a, const Option<U> &b) {
+    return !OptionCompare::lt(a, b);
+}
+
+template <typename T> inline bool operator==(const Option<T> &a, None) {
+    return a.is_none();
+}
+
+template <typename T> inline bool operator==(None, const Option<T> &b) {
+    return b.is_none();
+}
+
+template <typename T> inline bool operator!=(const Option<T> &a, None) {
+    return a.is_some();
+}
+
+template <typename T> inline bool operator!=(None, const Option<T> &b) {
+    return b.is_some();
+}
+
+template <typename T> inline bool operator<(const Option<T> &, None) {
+    return false;
+}
+
+template <typename T> inline bool operator<(None, const Option<T> &b) {
+    return b.is_some();
+}
+
+template <typename T> inline bool operator>(const Option<T> &a, None) {
+    return a.is_some();
+}
+
+template <typename T> inline bool operator>(None, const Option<T> &) {
+    return false;
+}
+
+template <typename T> inline bool operator<=(const Option<T> &a, None) {
+    return a.is_none();
+}
+
+template <typename T> inline bool operator<=(None, const Option<T> &) {
+    return true;
+}
+
+template <typename T> inline bool operator>=(const Option<T> &, None) {
+    return true;
+}
+
+template <typename T> inline bool operator>=(None, const Option<T> &b) {
+    return b.is_none();
+}
+
+// Comparisons against a plain value treat it as Some(value).
+template <typename T, typename U RUSTISH_ENABLE_IF((IsPlainOperand<U>::value))>
+inline bool operator==(const Option<T> &a, const U &b)
+    RUSTISH_REQUIRES((IsPlainOperand<U>::value)) {
+    return OptionCompare::eq_value(a, b);
+}
+
+template <typename T, typename U RUSTISH_ENABLE_IF((IsPlainOperand<U>::value))>
+inline bool operator==(const U &a, const Option<T> &b)
+    RUSTISH_REQUIRES((IsPlainOperand<U>::value)) {
+    return OptionCompare::eq_value(b, a);
+}
+
+template <typename T, typename U RUSTISH_ENABLE_IF((IsPlainOperand<U>::value))>
+inline bool operator!=(const Option<T> &a, const U &b)
+    RUSTISH_REQUIRES((IsPlainOperand<U>::value)) {
+    return !OptionCompare::eq_value(a, b);
+}
+
+template <typename T, typename U RUSTISH_ENABLE_IF((IsPlainOperand<U>::value))>
+inline bool operator!=(const U &a, const Option<T> &b)
+    RUSTISH_REQUIRES((IsPlainOperand<U>::value)) {
+    return !OptionCompare::eq_value(b, a);
+}
+
+template <typename T, typename U RUSTISH_ENABLE_IF((IsPlainOperand<U>::value))>
+inline bool operator<(const Option<T> &a, const U &b)
+    RUSTISH_REQUIRES((IsPlainOperand<U>::value)) {
+    return OptionCompare::lt_value(a, b);
+}
+
+template <typename T, typename U RUSTISH_ENABLE_IF((IsPlainOperand<U>::value))>
+inline bool operator<(const U &a, const Option<T> &b)
+    RUSTISH_REQUIRES((IsPlainOperand<U>::value)) {
+    return OptionCompare::gt_value(b, a);
+}
+
+template <typename T, typename U RUSTISH_ENABLE_IF((IsPlainOperand<U>::value))>
+inline bool operator>(const Option<T> &a, const U &b)
+    RUSTISH_REQUIRES((IsPlainOperand<U>::value)) {
+    return OptionCompare::gt_value(a, b);
+}
+
+template <typename T, typename U RUSTISH_ENABLE_IF((IsPlainOperand<U>::value))>
+inline bool operator>(const U &a, const Option<T> &b)
+    RUSTISH_REQUIRES((IsPlainOperand<U>::value)) {
+    return OptionCompare::lt_value(b, a);
+}
+
+template <typename T, typename U RUSTISH_ENABLE_IF((IsPlainOperand<U>::value))>
+inline bool operator<=(const Option<T> &a, const U &b)
+    RUSTISH_REQUIRES((IsPlainOperand<U>::value)) {
+    return !OptionCompare::gt_value(a, b);
+}
+
+template <typename T, typename U RUSTISH_ENABLE_IF((IsPlainOperand<U>::value))>
+inline bool operator<=(const U &a, const Option<T> &b)
+    RUSTISH_REQUIRES((IsPlainOperand<U>::value)) {
+    return !OptionCompare::lt_value(b, a);
+}
+
+template <typename T, typename U RUSTISH_ENABLE_IF((IsPlainOperand<U>::value))>
+inline bool operator>=(const Option<T> &a, const U &b)
+    RUSTISH_REQUIRES((IsPlainOperand<U>::value)) {
+    return !OptionCompare::lt_value(a, b);
+}
+
+template <typename T, typename U RUSTISH_ENABLE_IF((IsPlainOperand<U>::value))>
+inline bool operator>=(const U &a, const Option<T> &b)
+    RUSTISH_REQUIRES((IsPlainOperand<U>::value)) {
+    return !OptionCompare::gt_value(b, a);
+}
+
+#if RUSTISH_HAS_THREE_WAY
+template <typename T, typename U>
+inline auto operator<=>(const Option<T> &a, const Option<U> &b) {
+    return OptionCompare::cmp(a, b);
+}
+
+template <typename T>
+inline std::strong_ordering operator<=>(const Option<T> &a, None) {
+    return a.is_some() <=> false;
+}
+
+template <typename T, typename U>
+    requires(IsPlainOperand<U>::value)
+inline auto operator<=>(const Option<T> &a, const U &b) {
+    return OptionCompare::cmp_value(a, b);
+}
+#endif
+
+} // namespace option
+} // namespace rustish
+
+namespace std {
+
+template <typename T> struct hash<rustish::option::Option<T>> {
+    size_t operator()(const rustish::option::Option<T> &opt) const {
+        return rustish::option::OptionCompare::hash(opt);
+    }
+};
+
+} // namespace std
+
+#endif //_RUSTISH_OPTION_COMPARE_HPP_
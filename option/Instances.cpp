@@ -0,0 +1,17 @@
+#include "Option.hpp"
+
+#include <string>
+
+namespace rustish {
+namespace option {
+
+#define RUSTISH_OPTION_INSTANTIATE(T)                                          \
+    template class OptionStorage<T>;                                           \
+    template class Option<T>;
+
+RUSTISH_OPTION_COMMON_PAYLOADS(RUSTISH_OPTION_INSTANTIATE)
+
+#undef RUSTISH_OPTION_INSTANTIATE
+
+} // namespace option
+} // namespace rustish
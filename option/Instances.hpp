@@ -0,0 +1,43 @@
+#ifndef _RUSTISH_OPTION_INSTANCES_HPP_
+#define _RUSTISH_OPTION_INSTANCES_HPP_
+
+// Included from Option.hpp; include that instead.
+
+// Payload types common enough that the rustish library target compiles
+// their Option instantiations once, in Instances.cpp.
+#define RUSTISH_OPTION_COMMON_PAYLOADS(X)                                      \
+    X(bool)                                                                    \
+    X(char)                                                                    \
+    X(int)                                                                     \
+    X(unsigned int)                                                            \
+    X(long)                                                                    \
+    X(unsigned long)                                                           \
+    X(long long)                                                               \
+    X(unsigned long long)                                                      \
+    X(float)                                                                   \
+    X(double)                                                                  \
+    X(std::string)
+
+// Linking the rustish target defines RUSTISH_OPTION_EXTERN_TEMPLATES, so
+// other TUs use those instantiations instead of making their own. The
+// instrumented build changes Option's members, so it keeps its own.
+#if defined(RUSTISH_OPTION_EXTERN_TEMPLATES) &&                                \
+    !defined(RUSTISH_OPTION_INSTRUMENT)
+#include <string>
+
+namespace rustish {
+namespace option {
+
+#define RUSTISH_OPTION_EXTERN(T)                                               \
+    extern template class OptionStorage<T>;                                    \
+    extern template class Option<T>;
+
+RUSTISH_OPTION_COMMON_PAYLOADS(RUSTISH_OPTION_EXTERN)
+
+#undef RUSTISH_OPTION_EXTERN
+
+} // namespace option
+} // namespace rustish
+#endif
+
+#endif //_RUSTISH_OPTION_INSTANCES_HPP_
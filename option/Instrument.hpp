@@ -0,0 +1,242 @@
+#ifndef _RUSTISH_OPTION_INSTRUMENT_HPP_
+#define _RUSTISH_OPTION_INSTRUMENT_HPP_
+
+// Call site counters for Option, compiled in only when
+// RUSTISH_OPTION_INSTRUMENT is defined. Every translation unit of a program
+// must agree on the flag, since it changes Option's member signatures.
+//
+// Instrumented methods record whether the Option was Some ("hit") or None
+// ("miss") at each call site. Each thread counts into its own table, so
+// recording takes no locks and shares no cache lines; snapshot() merges
+// the tables of all threads, including ones that have exited.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__has_include)
+#if __has_include(<source_location>) && __cplusplus > 201703L
+#include <source_location>
+#endif
+#endif
+
+namespace rustish {
+namespace option {
+namespace instrument {
+
+struct Site {
+    const char *file;
+    unsigned line;
+};
+
+struct SiteStats {
+    std::string file;
+    unsigned line;
+    std::string method;
+    uint64_t some;
+    uint64_t none;
+};
+
+namespace detail {
+
+// Open addressing table written by one thread and read by snapshot().
+// A slot's key is written before used is set with release, and counters
+// are only ever stored by the owner, so readers need no lock.
+class ThreadTable {
+    static constexpr size_t capacity = 4096;
+
+    struct Slot {
+        std::atomic<bool> used{false};
+        const char *file = nullptr;
+        unsigned line = 0;
+        const char *method = nullptr;
+        std::atomic<uint64_t> some{0};
+        std::atomic<uint64_t> none{0};
+    };
+
+  public:
+    void record(const Site &site, const char *method, bool some) {
+        Slot *slot = find(site, method);
+        if (!slot) {
+            bump(m_dropped);
+            return;
+        }
+        bump(some ? slot->some : slot->none);
+    }
+
+    template <typename F> void for_each(F &&f) const {
+        for (const Slot &slot : m_slots)
+            if (slot.used.load(std::memory_order_acquire))
+                f(slot.file, slot.line, slot.method,
+                  slot.some.load(std::memory_order_relaxed),
+                  slot.none.load(std::memory_order_relaxed));
+    }
+
+    uint64_t dropped() const {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+    void reset() {
+        for (Slot &slot : m_slots) {
+            slot.some.store(0, std::memory_order_relaxed);
+            slot.none.store(0, std::memory_order_relaxed);
+        }
+        m_dropped.store(0, std::memory_order_relaxed);
+    }
+
+  private:
+    // Single writer, so a load and a store replace a locked add.
+    static void bump(std::atomic<uint64_t> &counter) {
+        counter.store(counter.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+    }
+
+    // Keys compare by pointer: string literals are stable for the life of
+    // the program. snapshot() merges duplicates by content.
+    Slot *find(const Site &site, const char *method) {
+        uintptr_t h = reinterpret_cast<uintptr_t>(site.file) ^
+                      (uintptr_t(site.line) << 16) ^
+                      reinterpret_cast<uintptr_t>(method);
+        h *= 0x9E3779B97F4A7C15ull;
+        for (size_t i = 0; i < capacity; ++i) {
+            Slot &slot = m_slots[(h + i) & (capacity - 1)];
+            if (!slot.used.load(std::memory_order_relaxed)) {
+                slot.file = site.file;
+                slot.line = site.line;
+                slot.method = method;
+                slot.used.store(true, std::memory_order_release);
+                return &slot;
+            }
+            if (slot.line == site.line && slot.file == site.file &&
+                slot.method == method)
+                return &slot;
+        }
+        return nullptr;
+    }
+
+    Slot m_slots[capacity];
+    std::atomic<uint64_t> m_dropped{0};
+};
+
+// Tables are never freed so counts survive their threads.
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadTable *> tables;
+
+    static Registry &get() {
+        static Registry *registry = new Registry();
+        return *registry;
+    }
+};
+
+inline ThreadTable &local_table() {
+    static thread_local ThreadTable *table = [] {
+        ThreadTable *t = new ThreadTable();
+        Registry &r = Registry::get();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.tables.push_back(t);
+        return t;
+    }();
+    return *table;
+}
+
+} // namespace detail
+
+inline void record(const Site &site, const char *method, bool some) {
+    detail::local_table().record(site, method, some);
+}
+
+// Counters of every call site seen by any thread, most misses first.
+inline std::vector<SiteStats> snapshot() {
+    std::vector<SiteStats> stats;
+    detail::Registry &r = detail::Registry::get();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (const detail::ThreadTable *table : r.tables)
+        table->for_each([&](const char *file, unsigned line,
+                            const char *method, uint64_t some, uint64_t none) {
+            for (SiteStats &s : stats) {
+                if (s.line == line && s.file == file && s.method == method) {
+                    s.some += some;
+                    s.none += none;
+                    return;
+                }
+            }
+            stats.push_back(SiteStats{file, line, method, some, none});
+        });
+
+    std::sort(stats.begin(), stats.end(),
+              [](const SiteStats &a, const SiteStats &b) {
+                  if (a.none != b.none)
+                      return a.none > b.none;
+                  return a.some > b.some;
+              });
+    return stats;
+}
+
+// Calls that did not fit in their thread's table.
+inline uint64_t dropped() {
+    detail::Registry &r = detail::Registry::get();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    uint64_t n = 0;
+    for (const detail::ThreadTable *table : r.tables)
+        n += table->dropped();
+    return n;
+}
+
+// Zeroes all counters. Counts recorded concurrently may be lost.
+inline void reset() {
+    detail::Registry &r = detail::Registry::get();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (detail::ThreadTable *table : r.tables)
+        table->reset();
+}
+
+// One line per call site: file:line method some=N none=N.
+inline void dump(std::ostream &out) {
+    for (const SiteStats &s : snapshot())
+        out << s.file << ':' << s.line << ' ' << s.method << " some=" << s.some
+            << " none=" << s.none << '\n';
+    uint64_t lost = dropped();
+    if (lost)
+        out << "(" << lost << " calls at untracked sites)\n";
+}
+
+} // namespace instrument
+} // namespace option
+} // namespace rustish
+
+// Trailing parameters and recording statement used by the instrumented
+// methods of Option. The defaults are evaluated at the caller, which is
+// what identifies the call site: std::source_location where available,
+// otherwise the equivalent GCC/Clang builtins. Without
+// RUSTISH_OPTION_INSTRUMENT, Option.hpp defines them as no-ops and this
+// header only provides the reporting functions.
+#ifdef RUSTISH_OPTION_INSTRUMENT
+#if defined(__cpp_lib_source_location)
+#define RUSTISH_OPTION_SITE_PARAM                                              \
+    , std::source_location rustish_site = std::source_location::current()
+#define RUSTISH_OPTION_RECORD(method)                                          \
+    ::rustish::option::instrument::record(                                     \
+        ::rustish::option::instrument::Site{                                   \
+            rustish_site.file_name(),                                          \
+            static_cast<unsigned>(rustish_site.line())},                       \
+        method, is_some())
+#else
+#define RUSTISH_OPTION_SITE_PARAM                                              \
+    , const char *rustish_site_file = __builtin_FILE(),                        \
+      unsigned rustish_site_line = __builtin_LINE()
+#define RUSTISH_OPTION_RECORD(method)                                          \
+    ::rustish::option::instrument::record(                                     \
+        ::rustish::option::instrument::Site{rustish_site_file,                 \
+                                            rustish_site_line},                \
+        method, is_some())
+#endif
+#endif
+
+#endif //_RUSTISH_OPTION_INSTRUMENT_HPP_
@@ -0,0 +1,132 @@
+#ifndef _RUSTISH_OPTION_INTEROP_HPP_
+#define _RUSTISH_OPTION_INTEROP_HPP_
+
+#include "Option.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<optional>)
+#include <optional>
+#define RUSTISH_HAS_OPTIONAL 1
+#endif
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#include <expected>
+#define RUSTISH_HAS_EXPECTED 1
+#endif
+
+#ifndef RUSTISH_HAS_OPTIONAL
+#define RUSTISH_HAS_OPTIONAL 0
+#endif
+#ifndef RUSTISH_HAS_EXPECTED
+#define RUSTISH_HAS_EXPECTED 0
+#endif
+
+namespace rustish {
+namespace option {
+
+// Conversions between Option and nullable pointers, std::optional and
+// std::expected. Borrowing conversions copy only an address; consuming ones
+// move the payload straight from one container's buffer into the other's.
+
+// Converts to T by moving the payload out of an Option that is Some.
+// Passed as an in-place constructor argument, the payload is returned from
+// the conversion as a prvalue and so is built directly in its destination.
+template <typename T> struct TakePayload {
+    Option<T> &opt;
+
+    operator T() { return opt.unwrap_unchecked(); }
+};
+
+// Option<T&> is stored as a pointer, so this only copies ptr.
+template <typename T> inline Option<T &> from_ptr(T *ptr) {
+    if (ptr)
+        return Option<T &>(*ptr);
+    return {};
+}
+
+// Address of the payload, or nullptr for None. The Option keeps the value.
+template <typename T> inline T *as_ptr(Option<T> &opt) {
+    if (opt.is_some())
+        return &opt.as_mut().unwrap_unchecked();
+    return nullptr;
+}
+
+template <typename T> inline const T *as_ptr(const Option<T> &opt) {
+    if (opt.is_some())
+        return &opt.as_ref().unwrap_unchecked();
+    return nullptr;
+}
+
+template <typename T> inline T *as_ptr(Option<T &> opt) {
+    if (opt.is_some())
+        return &opt.unwrap_unchecked();
+    return nullptr;
+}
+
+#if RUSTISH_HAS_OPTIONAL
+// Borrows the value of an optional without copying it.
+template <typename T>
+inline Option<const T &> from_optional(const std::optional<T> &opt) {
+    return from_ptr(opt ? &*opt : nullptr);
+}
+
+template <typename T> inline Option<T &> from_optional(std::optional<T> &opt) {
+    return from_ptr(opt ? &*opt : nullptr);
+}
+
+// Moves the value of an optional into an Option. The optional keeps its
+// moved-from value, as with std::optional's own move constructor.
+template <typename T> inline Option<T> from_optional(std::optional<T> &&opt) {
+    if (opt)
+        return Option<T>(InPlace(), std::move(*opt));
+    return {};
+}
+
+// Moves the payload into a std::optional, leaving the Option None.
+template <typename T> inline std::optional<T> into_optional(Option<T> &&opt) {
+    static_assert(!std::is_reference<T>::value,
+                  "into_optional() is not available for reference types; "
+                  "use as_ptr() instead");
+    if (opt.is_some())
+        return std::optional<T>(std::in_place, TakePayload<T>{opt});
+    return std::nullopt;
+}
+#endif
+
+#if RUSTISH_HAS_EXPECTED
+// Rust's Result::ok(): the value of an expected, discarding any error.
+template <typename T, typename E>
+inline Option<const T &> from_expected(const std::expected<T, E> &exp) {
+    return from_ptr(exp ? &*exp : nullptr);
+}
+
+template <typename T, typename E>
+inline Option<T> from_expected(std::expected<T, E> &&exp) {
+    if (exp)
+        return Option<T>(InPlace(), std::move(*exp));
+    return {};
+}
+
+// Rust's Option::ok_or(): the payload as an expected value, or err as its
+// error when None. The payload is moved out, leaving the Option None.
+template <typename T, typename E>
+inline std::expected<T, typename std::decay<E>::type>
+into_expected(Option<T> &&opt, E &&err) {
+    using Expected = std::expected<T, typename std::decay<E>::type>;
+    if (opt.is_some())
+        return Expected(std::in_place, TakePayload<T>{opt});
+    return Expected(std::unexpect, std::forward<E>(err));
+}
+#endif
+
+} // namespace option
+} // namespace rustish
+
+#endif //_RUSTISH_OPTION_INTEROP_HPP_
@@ -0,0 +1,107 @@
+#ifndef _RUSTISH_OPTION_LIKELY_HPP_
+#define _RUSTISH_OPTION_LIKELY_HPP_
+
+// Included from Option.hpp; include that instead.
+
+#include <type_traits>
+#include <utility>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define RUSTISH_EXPECT(cond, value) __builtin_expect(!!(cond), (value))
+#else
+#define RUSTISH_EXPECT(cond, value) (cond)
+#endif
+
+namespace rustish {
+namespace option {
+
+// View of an Option that tells the compiler which state to expect, so the
+// expected path is laid out straight-line and the other moved out of the
+// way. Obtained with Option::likely_some() or likely_none(). The methods
+// behave exactly like Option's, including moving the value out, and the
+// fallbacks are recorded under RUSTISH_OPTION_INSTRUMENT the same way.
+template <typename T, bool ExpectSome> class LikelyOption {
+    using param_t = typename Option<T>::param_t;
+    using ret_t = typename Option<T>::ret_t;
+    using ref_t = typename Option<T>::ref_t;
+
+  public:
+    explicit LikelyOption(Option<T> &opt) : m_opt(opt) {}
+
+    bool is_some() const {
+        return RUSTISH_EXPECT(m_opt.is_some(), ExpectSome);
+    }
+
+    bool is_none() const { return !is_some(); }
+
+    template <typename U RUSTISH_ENABLE_IF((IsConvertFrom<T, U>::value))>
+    ret_t unwrap_or(U &&def RUSTISH_OPTION_SITE_PARAM)
+        RUSTISH_REQUIRES((ConvertFrom<T, U>)) {
+        RUSTISH_OPTION_RECORD("unwrap_or");
+        if (is_some())
+            return m_opt.unwrap_unchecked();
+        return static_cast<ret_t>(std::forward<U>(def));
+    }
+
+    template <typename Func>
+    ret_t unwrap_or_else(Func &&f RUSTISH_OPTION_SITE_PARAM) {
+        RUSTISH_OPTION_RECORD("unwrap_or_else");
+        if (is_some())
+            return m_opt.unwrap_unchecked();
+        return f();
+    }
+
+    T unwrap_or_default() {
+        if (is_some())
+            return m_opt.unwrap_unchecked();
+        return T();
+    }
+
+    template <typename Func,
+              typename U = typename std::result_of<Func(param_t)>::type>
+    Option<U> map(Func &&f) {
+        if (is_some())
+            return Option<U>(f(m_opt.unwrap_unchecked()));
+        return {};
+    }
+
+    template <typename Func,
+              typename U = typename std::result_of<Func(param_t)>::type>
+    Option<U> map_or(U &&def, Func &&f) {
+        if (is_some())
+            return Option<U>(f(m_opt.unwrap_unchecked()));
+        return Option<U>(std::forward<U>(def));
+    }
+
+    template <typename Func,
+              typename U = typename std::result_of<Func(param_t)>::type::opt_t>
+    Option<U> and_then(Func &&f) {
+        if (is_some())
+            return f(m_opt.unwrap_unchecked());
+        return {};
+    }
+
+    template <typename Func>
+    Option<T> or_else(Func &&f RUSTISH_OPTION_SITE_PARAM) {
+        RUSTISH_OPTION_RECORD("or_else");
+        if (is_some())
+            return std::move(m_opt);
+        return f();
+    }
+
+    template <typename Func>
+    ref_t get_or_insert_with(Func &&f RUSTISH_OPTION_SITE_PARAM) {
+        RUSTISH_OPTION_RECORD("get_or_insert_with");
+        if (is_some())
+            return m_opt.as_mut().unwrap_unchecked();
+        return m_opt.insert(f());
+    }
+
+  private:
+    Option<T> &m_opt;
+};
+
+} // namespace option
+} // namespace rustish
+
+#endif //_RUSTISH_OPTION_LIKELY_HPP_
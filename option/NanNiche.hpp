@@ -0,0 +1,85 @@
+#ifndef _RUSTISH_OPTION_NAN_NICHE_HPP_
+#define _RUSTISH_OPTION_NAN_NICHE_HPP_
+
+#include "Option.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace rustish {
+namespace option {
+
+template <typename T> struct NanBits;
+
+// None is a signalling NaN with a fixed payload ("NONE" / "NO"). Arithmetic
+// never produces a signalling NaN (results are always quiet), so real NaNs
+// stay distinguishable from None by bit pattern.
+template <> struct NanBits<double> {
+    using bits_t = uint64_t;
+    static constexpr bits_t none = 0x7FF000004E4F4E45ull;
+    static constexpr bits_t quiet = 0x0008000000000000ull;
+};
+
+template <> struct NanBits<float> {
+    using bits_t = uint32_t;
+    static constexpr bits_t none = 0x7F804E4Fu;
+    static constexpr bits_t quiet = 0x00400000u;
+};
+
+// Floating point value whose Option uses a reserved NaN pattern as None, so
+// Option<NanNiche<double>> is 8 bytes and a column of them is a plain array
+// of doubles. Converts implicitly to and from T.
+template <typename T> class NanNiche {
+    static_assert(std::is_floating_point<T>::value &&
+                      (std::is_same<T, float>::value ||
+                       std::is_same<T, double>::value),
+                  "NanNiche supports float and double");
+
+    using bits_t = typename NanBits<T>::bits_t;
+
+  public:
+    // A NaN that happens to carry the reserved payload is quieted so it can
+    // never be mistaken for None.
+    NanNiche(T value) : m_value(value) {
+        if (bits() == NanBits<T>::none) {
+            bits_t quieted = NanBits<T>::none | NanBits<T>::quiet;
+            std::memcpy(&m_value, &quieted, sizeof(T));
+        }
+    }
+
+    operator T() const { return m_value; }
+
+    T get() const { return m_value; }
+
+    bits_t bits() const {
+        bits_t ret;
+        std::memcpy(&ret, &m_value, sizeof(T));
+        return ret;
+    }
+
+  private:
+    T m_value;
+};
+
+template <typename T> struct NicheTraits<NanNiche<T>> {
+    using bits_t = typename NanBits<T>::bits_t;
+
+    static constexpr bool available = true;
+
+    static void set_none(void *buff) {
+        bits_t none = NanBits<T>::none;
+        std::memcpy(buff, &none, sizeof(bits_t));
+    }
+
+    static bool is_none(const void *buff) {
+        bits_t bits;
+        std::memcpy(&bits, buff, sizeof(bits_t));
+        return bits == NanBits<T>::none;
+    }
+};
+
+} // namespace option
+} // namespace rustish
+
+#endif //_RUSTISH_OPTION_NAN_NICHE_HPP_
@@ -0,0 +1,101 @@
+#ifndef _RUSTISH_OPTION_NON_ZERO_HPP_
+#define _RUSTISH_OPTION_NON_ZERO_HPP_
+
+#include "Option.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace rustish {
+namespace option {
+
+// Integer known to be non-zero (counters, ids). Option<NonZero<T>> stores
+// None as zero and is exactly sizeof(T).
+template <typename T> class NonZero {
+    static_assert(std::is_integral<T>::value,
+                  "NonZero requires an integral type");
+
+  public:
+    // value must not be zero; use new_ when that is not known.
+    explicit NonZero(T value) : m_value(value) { assert(value != 0); }
+
+    static Option<NonZero> new_(T value) {
+        if (value == 0)
+            return {};
+        return Option<NonZero>(NonZero(value));
+    }
+
+    T get() const { return m_value; }
+
+    operator T() const { return m_value; }
+
+  private:
+    T m_value;
+};
+
+// Signed integer known to be >= 0 (sizes, file descriptors).
+// Option<NonNegative<T>> stores None as -1 and is exactly sizeof(T).
+template <typename T> class NonNegative {
+    static_assert(std::is_integral<T>::value && std::is_signed<T>::value,
+                  "NonNegative requires a signed integral type");
+
+  public:
+    // value must not be negative; use new_ when that is not known.
+    explicit NonNegative(T value) : m_value(value) { assert(value >= 0); }
+
+    static Option<NonNegative> new_(T value) {
+        if (value < 0)
+            return {};
+        return Option<NonNegative>(NonNegative(value));
+    }
+
+    T get() const { return m_value; }
+
+    operator T() const { return m_value; }
+
+  private:
+    T m_value;
+};
+
+template <typename T>
+struct NicheTraits<NonZero<T>> : ReservedValueNiche<T, T(0)> {
+    static_assert(sizeof(NonZero<T>) == sizeof(T),
+                  "NonZero must be layout compatible with T");
+};
+
+template <typename T>
+struct NicheTraits<NonNegative<T>> : ReservedValueNiche<T, T(-1)> {
+    static_assert(sizeof(NonNegative<T>) == sizeof(T),
+                  "NonNegative must be layout compatible with T");
+};
+
+using NonZeroU8 = NonZero<uint8_t>;
+using NonZeroU16 = NonZero<uint16_t>;
+using NonZeroU32 = NonZero<uint32_t>;
+using NonZeroU64 = NonZero<uint64_t>;
+using NonZeroI32 = NonZero<int32_t>;
+using NonZeroI64 = NonZero<int64_t>;
+
+} // namespace option
+} // namespace rustish
+
+namespace std {
+
+template <typename T> struct hash<rustish::option::NonZero<T>> {
+    size_t operator()(const rustish::option::NonZero<T> &value) const {
+        return hash<T>()(value.get());
+    }
+};
+
+template <typename T> struct hash<rustish::option::NonNegative<T>> {
+    size_t operator()(const rustish::option::NonNegative<T> &value) const {
+        return hash<T>()(value.get());
+    }
+};
+
+} // namespace std
+
+#endif //_RUSTISH_OPTION_NON_ZERO_HPP_
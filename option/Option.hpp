@@ -3,13 +3,22 @@
 
 #include "OptionStorage.hpp"
 
+#ifdef RUSTISH_OPTION_INSTRUMENT
+#include "Instrument.hpp"
+#else
+#define RUSTISH_OPTION_SITE_PARAM
+#define RUSTISH_OPTION_RECORD(method) ((void)0)
+#endif
+
+#include <cstdio>
 #include <exception>
-#include <iostream>
 
 namespace rustish {
 namespace option {
 struct None {};
 
+template <typename T, bool ExpectSome> class LikelyOption;
+
 template <typename T> struct ReturnDefault {
     static inline T &&pass(T &def) { return std::move(def); }
 };
@@ -22,6 +31,26 @@ template <typename T> struct ReturnDefault<const T &> {
     static inline const T &pass(const T &def) { return def; }
 };
 
+template <typename T> class Option;
+
+struct OptionCompare;
+
+// Arguments that construct an Option<T>'s payload rather than being an
+// Option<T> or None themselves.
+template <typename T, typename U> struct IsOptionArg {
+    using D = typename std::decay<U>::type;
+    static constexpr bool value = IsInitFrom<T, U>::value &&
+                                  !std::is_same<D, Option<T>>::value &&
+                                  !std::is_same<D, None>::value;
+};
+
+#if RUSTISH_HAS_CONCEPTS
+template <typename T, typename U>
+concept OptionArg =
+    !std::is_same_v<std::decay_t<U>, Option<T>> &&
+    !std::is_same_v<std::decay_t<U>, None> && InitFrom<T, U>;
+#endif
+
 template <typename T> class Option {
   public:
     using Storage = OptionStorage<T>;
@@ -34,15 +63,47 @@ template <typename T> class Option {
     Option() {}
     Option(None) {}
 
-    template <typename U, typename V = typename std::enable_if<
-                              IsSameDecayType<T, U>::value, void>::type>
-    Option(U &&value) : m_storage(std::forward<U>(value)) {}
+    // Builds the payload directly from value, e.g. an Option<std::string>
+    // from a const char *. Implicit when U converts to T implicitly.
+#if RUSTISH_HAS_CONCEPTS
+    template <typename U>
+        requires OptionArg<T, U>
+    explicit(!std::is_convertible_v<U &&, T>) Option(U &&value)
+        : m_storage(InPlace(), std::forward<U>(value)) {}
+#else
+    template <typename U,
+              typename std::enable_if<IsOptionArg<T, U>::value &&
+                                          std::is_convertible<U &&, T>::value,
+                                      int>::type = 0>
+    Option(U &&value) : m_storage(InPlace(), std::forward<U>(value)) {}
+
+    template <typename U,
+              typename std::enable_if<IsOptionArg<T, U>::value &&
+                                          !std::is_convertible<U &&, T>::value,
+                                      int>::type = 0>
+    explicit Option(U &&value) : m_storage(InPlace(), std::forward<U>(value)) {}
+#endif
+
+    // Builds the payload from args, e.g. a tuple from its elements.
+    template <typename... Args>
+    explicit Option(InPlace, Args &&...args)
+        : m_storage(InPlace(), std::forward<Args>(args)...) {}
 
     Option(const Option &) = default;
     Option &operator=(const Option &) = default;
     Option(Option &&) = default;
     Option &operator=(Option &&) = default;
 
+    // Constructs the new payload in place of the old one. Only implicit
+    // conversions, as for std::optional.
+    template <typename U RUSTISH_ENABLE_IF((IsOptionArg<T, U>::value &&
+                                            IsConvertFrom<T, U>::value))>
+    Option &operator=(U &&value)
+        RUSTISH_REQUIRES((OptionArg<T, U> && ConvertFrom<T, U>)) {
+        m_storage.emplace(std::forward<U>(value));
+        return *this;
+    }
+
     bool is_some() const { return m_storage.is_some(); }
 
     template <typename Func> bool is_some_and(Func &&f) {
@@ -53,6 +114,13 @@ template <typename T> class Option {
 
     bool is_none() const { return m_storage.is_none(); }
 
+    // Branch hints for the combinators; see Likely.hpp.
+    LikelyOption<T, true> likely_some() { return LikelyOption<T, true>(*this); }
+
+    LikelyOption<T, false> likely_none() {
+        return LikelyOption<T, false>(*this);
+    }
+
     Option<cref_t> as_ref() const {
         if (is_some())
             return Option<cref_t>(m_storage.cref());
@@ -70,26 +138,29 @@ template <typename T> class Option {
         if (is_some())
             return m_storage.get();
 
-        std::cerr << msg << std::endl;
+        std::fprintf(stderr, "%s\n", msg);
         std::terminate();
     }
 
     ret_t unwrap() {
         if (is_some())
             return m_storage.get();
-        std::cerr << "unwrap() called on Option with None value" << std::endl;
+        std::fputs("unwrap() called on Option with None value\n", stderr);
         std::terminate();
     }
 
-    template <typename U, typename V = typename std::enable_if<
-                              IsSameDecayType<T, U>::value, void>::type>
-    ret_t unwrap_or(U &&def) {
+    template <typename U RUSTISH_ENABLE_IF((IsConvertFrom<T, U>::value))>
+    ret_t unwrap_or(U &&def RUSTISH_OPTION_SITE_PARAM)
+        RUSTISH_REQUIRES((ConvertFrom<T, U>)) {
+        RUSTISH_OPTION_RECORD("unwrap_or");
         if (is_some())
             return m_storage.get();
-        return std::forward<U>(def);
+        return static_cast<ret_t>(std::forward<U>(def));
     }
 
-    template <typename Func> ret_t unwrap_or_else(Func &&f) {
+    template <typename Func>
+    ret_t unwrap_or_else(Func &&f RUSTISH_OPTION_SITE_PARAM) {
+        RUSTISH_OPTION_RECORD("unwrap_or_else");
         if (is_some())
             return m_storage.get();
         return f();
@@ -162,7 +233,9 @@ template <typename T> class Option {
         return std::move(opt);
     }
 
-    template <typename Func> Option<T> or_else(Func &&f) {
+    template <typename Func>
+    Option<T> or_else(Func &&f RUSTISH_OPTION_SITE_PARAM) {
+        RUSTISH_OPTION_RECORD("or_else");
         if (is_some())
             return std::move(*this);
         return f();
@@ -178,16 +251,14 @@ template <typename T> class Option {
             return std::move(opt);
     }
 
-    template <typename U, typename V = typename std::enable_if<
-                              IsSameDecayType<T, U>::value, void>::type>
-    ref_t insert(U &&value) {
-        m_storage = Storage(std::forward<U>(value));
+    template <typename U RUSTISH_ENABLE_IF((IsConvertFrom<T, U>::value))>
+    ref_t insert(U &&value) RUSTISH_REQUIRES((ConvertFrom<T, U>)) {
+        m_storage.emplace(std::forward<U>(value));
         return m_storage.ref();
     }
 
-    template <typename U, typename V = typename std::enable_if<
-                              IsSameDecayType<T, U>::value, void>::type>
-    ref_t get_or_insert(U &&value) {
+    template <typename U RUSTISH_ENABLE_IF((IsConvertFrom<T, U>::value))>
+    ref_t get_or_insert(U &&value) RUSTISH_REQUIRES((ConvertFrom<T, U>)) {
         if (is_some())
             return m_storage.ref();
         return insert(std::forward<U>(value));
@@ -199,14 +270,16 @@ template <typename T> class Option {
                       "reference types");
         if (is_some())
             return m_storage.ref();
-        m_storage = Storage(T());
+        m_storage.emplace();
         return m_storage.ref();
     }
 
-    template <typename Func> ref_t get_or_insert_with(Func &&f) {
+    template <typename Func>
+    ref_t get_or_insert_with(Func &&f RUSTISH_OPTION_SITE_PARAM) {
+        RUSTISH_OPTION_RECORD("get_or_insert_with");
         if (is_some())
             return m_storage.ref();
-        m_storage = Storage(f());
+        m_storage.emplace(f());
         return m_storage.ref();
     }
 
@@ -222,15 +295,16 @@ template <typename T> class Option {
         return {};
     }
 
-    template <typename U, typename V = typename std::enable_if<
-                              IsSameDecayType<T, U>::value, void>::type>
-    Option<T> replace(U &&value) {
+    template <typename U RUSTISH_ENABLE_IF((IsConvertFrom<T, U>::value))>
+    Option<T> replace(U &&value) RUSTISH_REQUIRES((ConvertFrom<T, U>)) {
         Option<T> ret = std::move(*this);
         insert(std::forward<U>(value));
         return ret;
     }
 
   private:
+    friend struct OptionCompare;
+
     OptionStorage<T> m_storage;
 };
 
@@ -241,4 +315,9 @@ template <typename T> inline Option<T> Some(T &&val) {
 } // namespace option
 } // namespace rustish
 
+#include "Compare.hpp"
+#include "Likely.hpp"
+
+#include "Instances.hpp"
+
 #endif //_RUSTISH_OPTION_OPTION_HPP_
@@ -1,6 +1,10 @@
 #ifndef _RUSTISH_OPTION_OPTION_STORAGE_HPP_
 #define _RUSTISH_OPTION_OPTION_STORAGE_HPP_
 
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -13,7 +17,162 @@ template <typename T, typename U> struct IsSameDecayType {
                      typename std::decay<U>::type>::value;
 };
 
-template <typename T> class OptionStorage {
+// Whether the payload of an Option<T> can be initialised from a U&&. Value
+// types accept anything T is constructible from; references only bind to
+// lvalues whose address converts, so a converted temporary can never be
+// captured by an Option<const T&>.
+template <typename T, typename U, bool = std::is_reference<T>::value>
+struct IsInitFrom {
+    static constexpr bool value = std::is_constructible<T, U &&>::value;
+};
+
+template <typename T, typename U> struct IsInitFrom<T, U, true> {
+    static constexpr bool value =
+        std::is_lvalue_reference<U &&>::value &&
+        std::is_convertible<typename std::remove_reference<U>::type *,
+                            typename std::remove_reference<T>::type *>::value;
+};
+
+// Whether a U&& converts to the payload implicitly. Assignment,
+// unwrap_or() and insert() take only these, like std::optional's operator=
+// and value_or(), so an explicit constructor (a sized std::vector, a
+// checked NonZero) is never called behind the caller's back. Explicit
+// conversions go through the InPlace constructor or the Option(U&&) one.
+template <typename T, typename U, bool = std::is_reference<T>::value>
+struct IsConvertFrom {
+    static constexpr bool value = std::is_convertible<U &&, T>::value;
+};
+
+template <typename T, typename U>
+struct IsConvertFrom<T, U, true> : IsInitFrom<T, U, true> {};
+
+// With concepts the same constraint is checked without instantiating the
+// trait classes above, which is cheaper in translation units with many
+// Option types. RUSTISH_ENABLE_IF and RUSTISH_REQUIRES let one declaration
+// use whichever is available:
+//   template <typename U RUSTISH_ENABLE_IF((IsInitFrom<T, U>::value))>
+//   void f(U &&u) RUSTISH_REQUIRES((InitFrom<T, U>));
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+#define RUSTISH_HAS_CONCEPTS 1
+
+template <typename T, typename U>
+concept InitFrom =
+    (!std::is_reference_v<T> && std::is_constructible_v<T, U &&>) ||
+    (std::is_reference_v<T> && std::is_lvalue_reference_v<U &&> &&
+     std::is_convertible_v<std::remove_reference_t<U> *,
+                           std::remove_reference_t<T> *>);
+
+template <typename T, typename U>
+concept ConvertFrom =
+    (!std::is_reference_v<T> && std::is_convertible_v<U &&, T>) ||
+    (std::is_reference_v<T> && InitFrom<T, U>);
+
+#define RUSTISH_ENABLE_IF(cond)
+#define RUSTISH_REQUIRES(cond) requires cond
+#else
+#define RUSTISH_HAS_CONCEPTS 0
+#define RUSTISH_ENABLE_IF(cond)                                                \
+    , typename std::enable_if<cond, int>::type = 0
+#define RUSTISH_REQUIRES(cond)
+#endif
+
+// Tells the optimizer that cond holds, so checks it implies can be dropped.
+#if defined(__GNUC__) || defined(__clang__)
+#define RUSTISH_ASSUME(cond)                                                   \
+    do {                                                                       \
+        if (!(cond))                                                           \
+            __builtin_unreachable();                                           \
+    } while (0)
+#else
+#define RUSTISH_ASSUME(cond) ((void)0)
+#endif
+
+// Tag selecting the constructors that build the payload from arguments.
+struct InPlace {};
+
+// Types with an object representation that never holds a valid value (a
+// "niche", such as a null owning pointer) can specialise NicheTraits so that
+// Option stores None in that representation instead of a separate tag.
+// A specialisation sets available to true and provides:
+//   static void set_none(void *buff);      - write the None marker into
+//                                            uninitialised storage for a T
+//   static bool is_none(const void *buff); - whether buff holds the marker
+template <typename T, typename Enable = void> struct NicheTraits {
+    static constexpr bool available = false;
+};
+
+// NicheTraits body for wrapper types that are laid out as a single Repr and
+// never hold Reserved, e.g.
+//   template <> struct NicheTraits<Handle> : ReservedValueNiche<int, -1> {};
+template <typename Repr, Repr Reserved> struct ReservedValueNiche {
+    static constexpr bool available = true;
+
+    static void set_none(void *buff) { new (buff) Repr(Reserved); }
+
+    static bool is_none(const void *buff) {
+        return *static_cast<const Repr *>(buff) == Reserved;
+    }
+};
+
+// A bool only ever holds 0 or 1, so Option<bool> marks None with 2 and fits
+// in a single byte.
+template <> struct NicheTraits<bool> {
+    static_assert(sizeof(bool) == 1, "Option<bool> niche assumes 1 byte bool");
+
+    static constexpr bool available = true;
+    static constexpr unsigned char none = 2;
+
+    static void set_none(void *buff) {
+        *static_cast<unsigned char *>(buff) = none;
+    }
+
+    static bool is_none(const void *buff) {
+        return *static_cast<const unsigned char *>(buff) == none;
+    }
+};
+
+// Enumerations opt in to niche storage by specialising EnumNiche, deriving
+// from one of the helpers below:
+//   template <> struct EnumNiche<Color> : EnumSpare<Color, Color(0xFF)> {};
+//   template <> struct EnumNiche<Mode> : EnumCount<Mode, 3> {};
+// Option<E> is then sizeof(E), i.e. one byte for enums backed by uint8_t.
+template <typename E> struct EnumNiche {
+    static constexpr bool available = false;
+};
+
+// Spare is a value of E that is never used as a real value.
+template <typename E, E Spare> struct EnumSpare {
+    static_assert(std::is_enum<E>::value, "EnumSpare requires an enum type");
+
+    static constexpr bool available = true;
+    static constexpr E none = Spare;
+};
+
+// The enumerators of E are exactly 0 .. Count - 1, so Count itself is spare.
+template <typename E, size_t Count>
+struct EnumCount
+    : EnumSpare<E, static_cast<E>(
+                       static_cast<typename std::underlying_type<E>::type>(
+                           Count))> {
+    static_assert(
+        Count < static_cast<size_t>(
+                    std::numeric_limits<
+                        typename std::underlying_type<E>::type>::max()),
+        "EnumCount requires a value of the underlying type to spare");
+};
+
+template <typename E>
+struct NicheTraits<E, typename std::enable_if<EnumNiche<E>::available>::type> {
+    static constexpr bool available = true;
+
+    static void set_none(void *buff) { new (buff) E(EnumNiche<E>::none); }
+
+    static bool is_none(const void *buff) {
+        return *static_cast<const E *>(buff) == EnumNiche<E>::none;
+    }
+};
+
+template <typename T, typename Enable = void> class OptionStorage {
     enum State {
         SOME,
         NONE,
@@ -25,27 +184,44 @@ template <typename T> class OptionStorage {
     using cref_t = const T &;
     using param_t = T;
 
+    // Arithmetic and enum payloads are zeroed while None and copied as
+    // plain bytes, so the buffer always holds a readable value and
+    // comparisons can use it without first checking the tag.
+    static constexpr bool determinate =
+        std::is_arithmetic<T>::value || std::is_enum<T>::value;
+
     inline static T *cast(char *buff) { return reinterpret_cast<T *>(buff); }
     inline static const T *cast_const(const char *buff) {
         return reinterpret_cast<const T *>(buff);
     }
 
-    OptionStorage() : m_state(NONE) {}
+    OptionStorage() : m_state(NONE) {
+        if (determinate)
+            std::memset(m_buff, 0, sizeof(T));
+    }
 
-    template <typename U, typename V = typename std::enable_if<
-                              IsSameDecayType<T, U>::value, void>::type>
-    OptionStorage(U &&value) : m_state(SOME) {
-        new (m_buff) T(std::forward<U>(value));
+    template <typename... Args>
+    explicit OptionStorage(InPlace, Args &&...args) : m_state(SOME) {
+        new (m_buff) T(std::forward<Args>(args)...);
     }
 
     OptionStorage(const OptionStorage &other) : m_state(other.m_state) {
-        new (m_buff) T(other.cref());
+        if (determinate)
+            std::memcpy(m_buff, other.m_buff, sizeof(T));
+        else if (is_some())
+            new (m_buff) T(other.cref());
     }
 
     OptionStorage &operator=(const OptionStorage &other) {
         if (this == &other)
             return *this;
 
+        if (determinate) {
+            std::memcpy(m_buff, other.m_buff, sizeof(T));
+            m_state = other.m_state;
+            return *this;
+        }
+
         if (is_some())
             cast(m_buff)->~T();
 
@@ -57,16 +233,25 @@ template <typename T> class OptionStorage {
     }
 
     OptionStorage(OptionStorage &&other) : m_state(other.m_state) {
-        if (is_some())
+        if (determinate) {
+            std::memcpy(m_buff, other.m_buff, sizeof(T));
+            other.m_state = NONE;
+        } else if (is_some()) {
             new (m_buff) T(other.get());
-
-        other.m_state = NONE;
+        }
     }
 
     OptionStorage &operator=(OptionStorage &&other) {
         if (this == &other)
             return *this;
 
+        if (determinate) {
+            std::memcpy(m_buff, other.m_buff, sizeof(T));
+            m_state = other.m_state;
+            other.m_state = NONE;
+            return *this;
+        }
+
         if (is_some())
             cast(m_buff)->~T();
 
@@ -74,8 +259,6 @@ template <typename T> class OptionStorage {
         if (is_some())
             new (m_buff) T(other.get());
 
-        other.m_state = NONE;
-
         return *this;
     }
 
@@ -84,13 +267,27 @@ template <typename T> class OptionStorage {
             cast(m_buff)->~T();
     }
 
+    // Replaces any current payload with one built from args.
+    template <typename... Args> void emplace(Args &&...args) {
+        if (is_some()) {
+            cast(m_buff)->~T();
+            m_state = NONE;
+        }
+        new (m_buff) T(std::forward<Args>(args)...);
+        m_state = SOME;
+    }
+
     bool is_some() const { return m_state == SOME; }
 
     bool is_none() const { return m_state == NONE; }
 
-    T &&get() {
+    // The moved-from payload is destroyed here, so it is not leaked when
+    // the Option later sees NONE.
+    T get() {
+        T ret(std::move(*cast(m_buff)));
+        cast(m_buff)->~T();
         m_state = NONE;
-        return std::move(*cast(m_buff));
+        return ret;
     }
 
     T &ref() { return *cast(m_buff); }
@@ -99,7 +296,131 @@ template <typename T> class OptionStorage {
 
   private:
     State m_state;
-    char m_buff[sizeof(T)];
+    alignas(T) char m_buff[sizeof(T)];
+};
+
+template <typename T>
+class OptionStorage<
+    T, typename std::enable_if<NicheTraits<T>::available>::type> {
+    using Niche = NicheTraits<T>;
+
+    // Trivially copyable payloads are copied together with the niche as
+    // plain bytes, without branching on presence.
+    static constexpr bool trivial = std::is_trivially_copyable<T>::value;
+
+  public:
+    using ret_t = T;
+    using ref_t = T &;
+    using cref_t = const T &;
+    using param_t = T;
+
+    // The None marker is not necessarily a valid T.
+    static constexpr bool determinate = false;
+
+    inline static T *cast(unsigned char *buff) {
+        return reinterpret_cast<T *>(buff);
+    }
+    inline static const T *cast_const(const unsigned char *buff) {
+        return reinterpret_cast<const T *>(buff);
+    }
+
+    OptionStorage() { Niche::set_none(m_buff); }
+
+    template <typename... Args>
+    explicit OptionStorage(InPlace, Args &&...args) {
+        new (m_buff) T(std::forward<Args>(args)...);
+    }
+
+    OptionStorage(const OptionStorage &other) {
+        if (trivial)
+            std::memcpy(m_buff, other.m_buff, sizeof(T));
+        else if (other.is_some())
+            new (m_buff) T(other.cref());
+        else
+            Niche::set_none(m_buff);
+    }
+
+    OptionStorage &operator=(const OptionStorage &other) {
+        if (this == &other)
+            return *this;
+
+        if (trivial) {
+            std::memcpy(m_buff, other.m_buff, sizeof(T));
+            return *this;
+        }
+
+        reset();
+        if (other.is_some())
+            new (m_buff) T(other.cref());
+
+        return *this;
+    }
+
+    OptionStorage(OptionStorage &&other) {
+        if (trivial) {
+            std::memcpy(m_buff, other.m_buff, sizeof(T));
+            Niche::set_none(other.m_buff);
+        } else if (other.is_some()) {
+            new (m_buff) T(other.get());
+        } else {
+            Niche::set_none(m_buff);
+        }
+    }
+
+    OptionStorage &operator=(OptionStorage &&other) {
+        if (this == &other)
+            return *this;
+
+        if (trivial) {
+            std::memcpy(m_buff, other.m_buff, sizeof(T));
+            Niche::set_none(other.m_buff);
+            return *this;
+        }
+
+        reset();
+        if (other.is_some())
+            new (m_buff) T(other.get());
+
+        return *this;
+    }
+
+    ~OptionStorage() {
+        if (is_some())
+            cast(m_buff)->~T();
+    }
+
+    // If constructing the new payload throws, the Option is left None.
+    template <typename... Args> void emplace(Args &&...args) {
+        reset();
+        new (m_buff) T(std::forward<Args>(args)...);
+    }
+
+    bool is_some() const { return !Niche::is_none(m_buff); }
+
+    bool is_none() const { return Niche::is_none(m_buff); }
+
+    // The niche overlaps the value, so the value has to be moved out before
+    // the None marker can be written back. Only called when Some.
+    T get() {
+        T ret(std::move(*cast(m_buff)));
+        cast(m_buff)->~T();
+        Niche::set_none(m_buff);
+        return ret;
+    }
+
+    T &ref() { return *cast(m_buff); }
+
+    const T &cref() const { return *cast_const(m_buff); }
+
+  private:
+    void reset() {
+        if (is_some()) {
+            cast(m_buff)->~T();
+            Niche::set_none(m_buff);
+        }
+    }
+
+    alignas(T) unsigned char m_buff[sizeof(T)];
 };
 
 template <typename T> class OptionStorage<T &> {
@@ -109,10 +430,14 @@ template <typename T> class OptionStorage<T &> {
     using cref_t = const T &;
     using param_t = T &;
 
-    OptionStorage(T &value) : m_ptr(&value) {}
+    static constexpr bool determinate = false;
+
+    OptionStorage(InPlace, T &value) : m_ptr(&value) {}
 
     OptionStorage() : m_ptr(nullptr) {}
 
+    void emplace(T &value) { m_ptr = &value; }
+
     OptionStorage(const OptionStorage &other) = default;
     OptionStorage &operator=(const OptionStorage &other) = default;
     OptionStorage &operator=(OptionStorage &&other) = default;
@@ -143,10 +468,14 @@ template <typename T> class OptionStorage<const T &> {
     using cref_t = const T &;
     using param_t = const T &;
 
-    OptionStorage(const T &value) : m_ptr(&value) {}
+    static constexpr bool determinate = false;
+
+    OptionStorage(InPlace, const T &value) : m_ptr(&value) {}
 
     OptionStorage() : m_ptr(nullptr) {}
 
+    void emplace(const T &value) { m_ptr = &value; }
+
     OptionStorage(const OptionStorage &other) = default;
     OptionStorage &operator=(const OptionStorage &other) = default;
     OptionStorage &operator=(OptionStorage &&other) = default;
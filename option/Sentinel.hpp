@@ -0,0 +1,55 @@
+#ifndef _RUSTISH_OPTION_SENTINEL_HPP_
+#define _RUSTISH_OPTION_SENTINEL_HPP_
+
+#include "Option.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace rustish {
+namespace option {
+
+// Integer that never holds Reserved. Option<Sentinel<T, Reserved>> stores
+// None as Reserved and is exactly sizeof(T).
+template <typename T, T Reserved> class Sentinel {
+    static_assert(std::is_integral<T>::value,
+                  "Sentinel requires an integral type");
+
+  public:
+    // value must not be Reserved; use new_ when that is not known.
+    explicit Sentinel(T value) : m_value(value) { assert(value != Reserved); }
+
+    static Option<Sentinel> new_(T value) {
+        if (value == Reserved)
+            return {};
+        return Option<Sentinel>(Sentinel(value));
+    }
+
+    T get() const { return m_value; }
+
+    operator T() const { return m_value; }
+
+  private:
+    T m_value;
+};
+
+template <typename T, T Reserved>
+struct NicheTraits<Sentinel<T, Reserved>> : ReservedValueNiche<T, Reserved> {
+    static_assert(sizeof(Sentinel<T, Reserved>) == sizeof(T),
+                  "Sentinel must be layout compatible with T");
+};
+
+// Position in an array, with the largest value of T reserved for None. An
+// Option<Index32> is 4 bytes where an Option<uint32_t> is 8.
+template <typename T, T Reserved = std::numeric_limits<T>::max()>
+using Index = Sentinel<T, Reserved>;
+
+using Index32 = Index<uint32_t>;
+using Index64 = Index<uint64_t>;
+
+} // namespace option
+} // namespace rustish
+
+#endif //_RUSTISH_OPTION_SENTINEL_HPP_
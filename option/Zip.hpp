@@ -0,0 +1,101 @@
+#ifndef _RUSTISH_OPTION_ZIP_HPP_
+#define _RUSTISH_OPTION_ZIP_HPP_
+
+#include "Option.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace rustish {
+namespace option {
+
+// Presence of every Option is combined with bitwise & rather than &&, so
+// all the checks are evaluated before branching. For tagged storage this
+// ORs the tags together and tests them once; niche storage compares each
+// payload with its marker directly.
+struct ZipImpl {
+    static bool all() { return true; }
+
+    template <typename... Bools> static bool all(bool first, Bools... rest) {
+        return first & all(rest...);
+    }
+
+    template <typename... Args> struct WithAll {
+        static constexpr size_t count = sizeof...(Args) - 1;
+        using Func =
+            typename std::tuple_element<count, std::tuple<Args...>>::type;
+
+        template <size_t I>
+        using Opt = typename std::decay<
+            typename std::tuple_element<I, std::tuple<Args...>>::type>::type;
+
+        template <typename Seq> struct Result;
+        template <size_t... Is> struct Result<std::index_sequence<Is...>> {
+            using type = typename std::result_of<Func(
+                typename Opt<Is>::param_t...)>::type;
+        };
+
+        using Seq = std::make_index_sequence<count>;
+        using R = typename Result<Seq>::type;
+        // Handlers returning void report whether they ran instead.
+        using type = typename std::conditional<std::is_void<R>::value, bool,
+                                               Option<R>>::type;
+
+        template <size_t... Is>
+        static bool call(std::tuple<Args &&...> args,
+                         std::index_sequence<Is...>, std::true_type) {
+            if (!all(std::get<Is>(args).is_some()...))
+                return false;
+            std::get<count>(args)(std::get<Is>(args).unwrap_unchecked()...);
+            return true;
+        }
+
+        template <size_t... Is>
+        static Option<R> call(std::tuple<Args &&...> args,
+                              std::index_sequence<Is...>, std::false_type) {
+            if (!all(std::get<Is>(args).is_some()...))
+                return {};
+            auto &f = std::get<count>(args);
+            return Option<R>(InPlace(),
+                             f(std::get<Is>(args).unwrap_unchecked()...));
+        }
+    };
+};
+
+// Whether every Option holds a value.
+template <typename... Opts> inline bool all_some(const Opts &...opts) {
+    return ZipImpl::all(opts.is_some()...);
+}
+
+// Some of a tuple holding every payload if all the Options hold values, in
+// which case each payload is moved out once and the Options are left None.
+// Otherwise None, and the Options are left as they were.
+template <typename... Opts>
+inline Option<std::tuple<typename std::decay<Opts>::type::opt_t...>>
+zip(Opts &&...opts) {
+    using Tuple = std::tuple<typename std::decay<Opts>::type::opt_t...>;
+    if (!ZipImpl::all(opts.is_some()...))
+        return {};
+    return Option<Tuple>(InPlace(), opts.unwrap_unchecked()...);
+}
+
+// with_all(a, b, c, f) calls f with the payloads of a, b and c if all of
+// them hold values, moving each payload out once. Returns Some of the
+// result, or None if any Option was None; a handler returning void makes
+// it return whether f was called instead.
+template <typename... Args>
+inline typename ZipImpl::WithAll<Args...>::type with_all(Args &&...args) {
+    using Impl = ZipImpl::WithAll<Args...>;
+    static_assert(sizeof...(Args) >= 2,
+                  "with_all() takes at least one Option and a function");
+    return Impl::call(std::forward_as_tuple(std::forward<Args>(args)...),
+                      typename Impl::Seq(),
+                      std::is_void<typename Impl::R>());
+}
+
+} // namespace option
+} // namespace rustish
+
+#endif //_RUSTISH_OPTION_ZIP_HPP_
@@ -0,0 +1,124 @@
+#ifndef _RUSTISH_SYNC_ARC_SWAP_HPP_
+#define _RUSTISH_SYNC_ARC_SWAP_HPP_
+
+#include "../alloc/Global.hpp"
+#include "../boxed/Arc.hpp"
+#include "../option/Option.hpp"
+#include "Epoch.hpp"
+
+#include <atomic>
+#include <utility>
+
+namespace rustish {
+namespace sync {
+
+// An Option<Arc<T>> that can be replaced while other threads read it, for
+// data that is read constantly and replaced rarely (configuration, routing
+// tables). load() is wait-free and leaves the reference count alone: it
+// pins the epoch and borrows the current value. Writers exchange the
+// pointer and retire the reference they displaced, which is released once
+// no pinned reader can still see it, so writers never wait for readers.
+// Since writes are rare and the values large, every write also collects,
+// so without readers pinned at most one displaced value is waiting.
+template <typename T, typename Alloc = alloc::Global> class ArcSwapOption {
+    using Arc = boxed::Arc<T, Alloc>;
+    using Inner = typename Arc::Inner;
+
+  public:
+    // The value current at load(), borrowed. It keeps the thread pinned,
+    // which holds back reclamation everywhere, so keep it short-lived and
+    // drop it on the thread that loaded it.
+    class Snapshot {
+      public:
+        bool is_some() const { return m_inner != nullptr; }
+
+        bool is_none() const { return m_inner == nullptr; }
+
+        option::Option<const T &> as_ref() const {
+            if (m_inner)
+                return option::Option<const T &>(m_inner->value);
+            return {};
+        }
+
+      private:
+        friend class ArcSwapOption;
+
+        Snapshot(Epoch::Guard guard, Inner *inner)
+            : m_guard(std::move(guard)), m_inner(inner) {}
+
+        Epoch::Guard m_guard;
+        Inner *m_inner;
+    };
+
+    ArcSwapOption() : m_inner(nullptr) {}
+
+    explicit ArcSwapOption(option::Option<Arc> value)
+        : m_inner(into_raw(value)) {}
+
+    ArcSwapOption(const ArcSwapOption &) = delete;
+    ArcSwapOption &operator=(const ArcSwapOption &) = delete;
+
+    // No other thread may still be using the ArcSwapOption.
+    ~ArcSwapOption() { Arc::release(m_inner.load(std::memory_order_relaxed)); }
+
+    Snapshot load() const {
+        Epoch::Guard guard = Epoch::pin();
+        return Snapshot(std::move(guard),
+                        m_inner.load(std::memory_order_seq_cst));
+    }
+
+    // A reference of its own to the current value, for keeping it beyond a
+    // Snapshot's lifetime. Costs a reference count increment.
+    option::Option<Arc> load_full() const {
+        Epoch::Guard guard = Epoch::pin();
+        Inner *inner = m_inner.load(std::memory_order_seq_cst);
+        if (!inner)
+            return {};
+        Arc::retain(inner);
+        return option::Option<Arc>(Arc(inner));
+    }
+
+    // Publishes value, or clears the current one when value is None.
+    void store(option::Option<Arc> value) {
+        retire(m_inner.exchange(into_raw(value), std::memory_order_seq_cst));
+    }
+
+    // Publishes value and returns the value it replaced.
+    option::Option<Arc> swap(option::Option<Arc> value) {
+        Inner *old =
+            m_inner.exchange(into_raw(value), std::memory_order_seq_cst);
+        if (!old)
+            return {};
+        // Readers may still be borrowing old, so the reference held by
+        // this ArcSwapOption is retired and the caller gets a new one.
+        Arc::retain(old);
+        retire(old);
+        return option::Option<Arc>(Arc(old));
+    }
+
+  private:
+    static Inner *into_raw(option::Option<Arc> &value) {
+        if (value.is_none())
+            return nullptr;
+        Arc arc = value.unwrap_unchecked();
+        Inner *inner = arc.m_inner;
+        arc.m_inner = nullptr;
+        return inner;
+    }
+
+    static void release(void *inner) {
+        Arc::release(static_cast<Inner *>(inner));
+    }
+
+    static void retire(Inner *inner) {
+        if (inner)
+            Epoch::retire_and_collect(inner, &ArcSwapOption::release);
+    }
+
+    std::atomic<Inner *> m_inner;
+};
+
+} // namespace sync
+} // namespace rustish
+
+#endif //_RUSTISH_SYNC_ARC_SWAP_HPP_
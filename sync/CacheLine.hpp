@@ -0,0 +1,33 @@
+#ifndef _RUSTISH_SYNC_CACHE_LINE_HPP_
+#define _RUSTISH_SYNC_CACHE_LINE_HPP_
+
+#include <cstddef>
+#include <utility>
+
+namespace rustish {
+namespace sync {
+
+// Distance that keeps two independently written variables from sharing a
+// cache line. 64 bytes covers current x86-64 and most AArch64 parts.
+constexpr size_t cache_line_size = 64;
+
+// A T aligned and padded to whole cache lines, so that writes to it never
+// contend with writes to a neighbouring object.
+template <typename T> struct alignas(cache_line_size) CachePadded {
+    CachePadded() : value() {}
+
+    explicit CachePadded(T v) : value(std::move(v)) {}
+
+    T &operator*() { return value; }
+    const T &operator*() const { return value; }
+
+    T *operator->() { return &value; }
+    const T *operator->() const { return &value; }
+
+    T value;
+};
+
+} // namespace sync
+} // namespace rustish
+
+#endif //_RUSTISH_SYNC_CACHE_LINE_HPP_
@@ -0,0 +1,141 @@
+#ifndef _RUSTISH_SYNC_CHASE_LEV_DEQUE_HPP_
+#define _RUSTISH_SYNC_CHASE_LEV_DEQUE_HPP_
+
+#include "../option/Option.hpp"
+#include "CacheLine.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace rustish {
+namespace sync {
+
+// Growable work-stealing deque (Chase and Lev, with the C11 orderings from
+// Le et al. 2013). The owning thread pushes and pops at the bottom; any
+// thread may steal from the top. Elements are read before the claiming CAS,
+// so T must be trivially copyable, typically a pointer to a task.
+template <typename T> class ChaseLevDeque {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "ChaseLevDeque requires a trivially copyable type");
+
+    struct Buffer {
+        explicit Buffer(int64_t capacity)
+            : mask(capacity - 1), items(new std::atomic<T>[capacity]) {}
+
+        int64_t capacity() const { return mask + 1; }
+
+        T get(int64_t i) const {
+            return items[i & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(int64_t i, T value) {
+            items[i & mask].store(value, std::memory_order_relaxed);
+        }
+
+        int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> items;
+    };
+
+  public:
+    // Capacity is rounded up to a power of two and doubles when full.
+    explicit ChaseLevDeque(size_t capacity = 256) {
+        int64_t cap = 1;
+        while (cap < int64_t(capacity))
+            cap <<= 1;
+        m_buffers.emplace_back(new Buffer(cap));
+        m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+    }
+
+    ChaseLevDeque(const ChaseLevDeque &) = delete;
+    ChaseLevDeque &operator=(const ChaseLevDeque &) = delete;
+
+    // Approximate when other threads are stealing.
+    size_t len() const {
+        int64_t b = m_bottom.load(std::memory_order_relaxed);
+        int64_t t = m_top.load(std::memory_order_relaxed);
+        return b > t ? size_t(b - t) : 0;
+    }
+
+    bool is_empty() const { return len() == 0; }
+
+    // Owner only.
+    void push(T value) {
+        int64_t b = m_bottom.load(std::memory_order_relaxed);
+        int64_t t = m_top.load(std::memory_order_acquire);
+        Buffer *buf = m_buffer.load(std::memory_order_relaxed);
+        if (b - t > buf->mask)
+            buf = grow(buf, b, t);
+        buf->put(b, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // Owner only. Takes the most recently pushed value.
+    option::Option<T> pop() {
+        int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+        Buffer *buf = m_buffer.load(std::memory_order_relaxed);
+        m_bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = m_top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+            return {};
+        }
+
+        T value = buf->get(b);
+        if (t == b) {
+            // Last element: race the thieves for it.
+            bool won = m_top.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst,
+                std::memory_order_relaxed);
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+            if (!won)
+                return {};
+        }
+        return option::Option<T>(value);
+    }
+
+    // Any thread. Takes the oldest value. None means empty or that another
+    // thread won the race, so callers treat it as "try elsewhere".
+    option::Option<T> steal() {
+        int64_t t = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = m_bottom.load(std::memory_order_acquire);
+        if (t >= b)
+            return {};
+
+        Buffer *buf = m_buffer.load(std::memory_order_acquire);
+        T value = buf->get(t);
+        if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                           std::memory_order_relaxed))
+            return {};
+        return option::Option<T>(value);
+    }
+
+  private:
+    // Old buffers stay alive until the deque is destroyed, since a thief
+    // may still be reading from one.
+    Buffer *grow(Buffer *old, int64_t b, int64_t t) {
+        m_buffers.emplace_back(new Buffer(old->capacity() * 2));
+        Buffer *buf = m_buffers.back().get();
+        for (int64_t i = t; i < b; ++i)
+            buf->put(i, old->get(i));
+        m_buffer.store(buf, std::memory_order_release);
+        return buf;
+    }
+
+    alignas(cache_line_size) std::atomic<int64_t> m_top{0};
+    alignas(cache_line_size) std::atomic<int64_t> m_bottom{0};
+    std::atomic<Buffer *> m_buffer{nullptr};
+    std::vector<std::unique_ptr<Buffer>> m_buffers;
+};
+
+} // namespace sync
+} // namespace rustish
+
+#endif //_RUSTISH_SYNC_CHASE_LEV_DEQUE_HPP_
@@ -0,0 +1,226 @@
+#ifndef _RUSTISH_SYNC_EPOCH_HPP_
+#define _RUSTISH_SYNC_EPOCH_HPP_
+
+#include "../alloc/Global.hpp"
+#include "CacheLine.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace rustish {
+namespace sync {
+
+// Epoch based reclamation for data read without locks or reference counts.
+// A reader pins the global epoch while it holds pointers into a shared
+// structure. A writer that unlinks memory retires it instead of freeing it,
+// tagged with the epoch current at the time. The epoch only advances once
+// every pinned thread has seen the current value, so memory is freed once
+// the epoch has moved two past its tag and no reader can still reach it.
+//
+// Pinning is wait-free: one store to a per-thread record. Retired memory
+// is freed by collect(), which retire() runs every collect_every calls and
+// retire_and_collect() runs every time.
+// Whatever a thread still holds when it exits is handed to the next thread
+// that collects.
+class Epoch {
+    struct alignas(cache_line_size) Record {
+        // The pinned epoch, or 0 while the thread is not pinned.
+        std::atomic<uint64_t> epoch{0};
+        std::atomic<bool> in_use{true};
+        Record *next = nullptr;
+    };
+
+    struct Retired {
+        void *ptr;
+        void (*drop)(void *);
+        uint64_t epoch;
+    };
+
+    struct Domain {
+        std::atomic<uint64_t> epoch{1};
+        std::atomic<Record *> records{nullptr};
+        std::atomic<bool> has_orphans{false};
+        std::mutex orphans_lock;
+        std::vector<Retired> orphans;
+    };
+
+    struct Local {
+        Local() : record(acquire_record()) {}
+
+        ~Local() {
+            collect(*this);
+            if (!garbage.empty()) {
+                Domain &d = domain();
+                std::lock_guard<std::mutex> lock(d.orphans_lock);
+                d.orphans.insert(d.orphans.end(), garbage.begin(),
+                                 garbage.end());
+                d.has_orphans.store(true, std::memory_order_release);
+            }
+            record->in_use.store(false, std::memory_order_release);
+        }
+
+        Record *record;
+        unsigned depth = 0;
+        std::vector<Retired> garbage;
+    };
+
+  public:
+    static constexpr size_t collect_every = 64;
+
+    // Keeps the calling thread pinned until it is dropped. Guards nest, and
+    // must be dropped on the thread that created them.
+    class Guard {
+      public:
+        Guard(Guard &&other) : m_active(other.m_active) {
+            other.m_active = false;
+        }
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+        ~Guard() {
+            if (m_active)
+                unpin();
+        }
+
+      private:
+        friend class Epoch;
+
+        Guard() : m_active(true) {}
+
+        bool m_active;
+    };
+
+    static Guard pin() {
+        Local &local = local_state();
+        if (local.depth++ == 0) {
+            // The store must be visible before any shared pointer is
+            // loaded, hence seq_cst rather than release.
+            uint64_t now = domain().epoch.load(std::memory_order_seq_cst);
+            local.record->epoch.store(now, std::memory_order_seq_cst);
+        }
+        return Guard();
+    }
+
+    // Calls drop(ptr) once no thread that might have loaded ptr before it
+    // was unlinked is still pinned. ptr must already be unreachable.
+    static void retire(void *ptr, void (*drop)(void *)) {
+        Local &local = local_state();
+        uint64_t now = domain().epoch.load(std::memory_order_seq_cst);
+        local.garbage.push_back(Retired{ptr, drop, now});
+        if (local.garbage.size() % collect_every == 0)
+            collect(local);
+    }
+
+    // retire() followed by collect(), for callers that retire rarely but
+    // retire large objects, such as a replaced routing table. Batching
+    // would keep the last collect_every of them alive; this way, with no
+    // thread pinned, each call frees everything retired before the previous
+    // call.
+    static void retire_and_collect(void *ptr, void (*drop)(void *)) {
+        Local &local = local_state();
+        uint64_t now = domain().epoch.load(std::memory_order_seq_cst);
+        local.garbage.push_back(Retired{ptr, drop, now});
+        collect(local);
+    }
+
+    // Tries to advance the epoch, then frees what this thread retired (and
+    // any orphans) that is old enough. A thread that is not pinned frees
+    // everything by calling it three times, unless others stay pinned.
+    static void collect() { collect(local_state()); }
+
+    // Retired pointers this thread has not freed yet.
+    static size_t pending() { return local_state().garbage.size(); }
+
+  private:
+    static Domain &domain() {
+        // Never destroyed: threads may exit after static destructors run.
+        static Domain *d = new Domain();
+        return *d;
+    }
+
+    static Local &local_state() {
+        static thread_local Local local;
+        return local;
+    }
+
+    // Records are reused by later threads but never freed.
+    static Record *acquire_record() {
+        Domain &d = domain();
+        for (Record *r = d.records.load(std::memory_order_acquire); r;
+             r = r->next) {
+            bool expected = false;
+            if (!r->in_use.load(std::memory_order_relaxed) &&
+                r->in_use.compare_exchange_strong(expected, true,
+                                                  std::memory_order_acquire))
+                return r;
+        }
+
+        void *mem = alloc::Global::allocate(sizeof(Record), alignof(Record));
+        Record *r = new (mem) Record();
+        Record *head = d.records.load(std::memory_order_relaxed);
+        do {
+            r->next = head;
+        } while (!d.records.compare_exchange_weak(head, r,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed));
+        return r;
+    }
+
+    static void unpin() {
+        Local &local = local_state();
+        if (--local.depth == 0)
+            local.record->epoch.store(0, std::memory_order_release);
+    }
+
+    static void try_advance(Domain &d) {
+        uint64_t now = d.epoch.load(std::memory_order_seq_cst);
+        for (Record *r = d.records.load(std::memory_order_acquire); r;
+             r = r->next) {
+            uint64_t pinned = r->epoch.load(std::memory_order_seq_cst);
+            if (pinned != 0 && pinned != now)
+                return;
+        }
+        d.epoch.compare_exchange_strong(now, now + 1,
+                                        std::memory_order_seq_cst);
+    }
+
+    static void collect(Local &local) {
+        Domain &d = domain();
+        try_advance(d);
+
+        if (d.has_orphans.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(d.orphans_lock);
+            local.garbage.insert(local.garbage.end(), d.orphans.begin(),
+                                 d.orphans.end());
+            d.orphans.clear();
+            d.has_orphans.store(false, std::memory_order_relaxed);
+        }
+
+        // Drop functions may retire more, so the ready ones are taken out
+        // of the list before any of them runs.
+        uint64_t now = d.epoch.load(std::memory_order_seq_cst);
+        std::vector<Retired> ready;
+        size_t kept = 0;
+        for (Retired &r : local.garbage) {
+            if (r.epoch + 2 <= now)
+                ready.push_back(r);
+            else
+                local.garbage[kept++] = r;
+        }
+        local.garbage.resize(kept);
+
+        for (Retired &r : ready)
+            r.drop(r.ptr);
+    }
+};
+
+} // namespace sync
+} // namespace rustish
+
+#endif //_RUSTISH_SYNC_EPOCH_HPP_
@@ -0,0 +1,219 @@
+#ifndef _RUSTISH_SYNC_MPMC_QUEUE_HPP_
+#define _RUSTISH_SYNC_MPMC_QUEUE_HPP_
+
+#include "../option/Option.hpp"
+#include "CacheLine.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace rustish {
+namespace sync {
+
+// Bounded multi-producer/multi-consumer queue after Dmitry Vyukov's design:
+// every slot carries a sequence number that says whether it is ready to be
+// written (seq == pos) or read (seq == pos + 1) for the lap at position pos,
+// so producers and consumers only contend on their own position counter.
+//
+// push() and pop() block: they spin for a short while, then sleep on a
+// condition variable. The mutex is only touched when a thread actually
+// sleeps or there is a sleeper to wake.
+template <typename T> class MpmcQueue {
+    struct Slot {
+        std::atomic<size_t> seq;
+        alignas(T) unsigned char buff[sizeof(T)];
+
+        T *ptr() { return reinterpret_cast<T *>(buff); }
+    };
+
+    static constexpr int spin_limit = 64;
+
+  public:
+    // Capacity is rounded up to a power of two (at least 2).
+    explicit MpmcQueue(size_t capacity)
+        : m_mask(round_up(capacity) - 1), m_slots(new Slot[m_mask + 1]) {
+        for (size_t i = 0; i <= m_mask; ++i)
+            m_slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    MpmcQueue(const MpmcQueue &) = delete;
+    MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+    ~MpmcQueue() {
+        while (try_pop_slot().is_some()) {
+        }
+    }
+
+    size_t capacity() const { return m_mask + 1; }
+
+    // After close() pushes fail and pop() returns None once the queue is
+    // drained. A push racing with close() may still be accepted.
+    void close() {
+        m_closed.store(true, std::memory_order_seq_cst);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_not_empty.notify_all();
+        m_not_full.notify_all();
+    }
+
+    bool is_closed() const { return m_closed.load(std::memory_order_acquire); }
+
+    // Returns None on success, or the value back when full or closed.
+    option::Option<T> try_push(T value) {
+        if (is_closed() || !try_push_slot(value))
+            return option::Option<T>(std::move(value));
+        wake(m_pop_waiters, m_not_empty);
+        return {};
+    }
+
+    option::Option<T> try_pop() {
+        option::Option<T> ret = try_pop_slot();
+        if (ret.is_some())
+            wake(m_push_waiters, m_not_full);
+        return ret;
+    }
+
+    // Waits for room. Returns the value back only if the queue is closed.
+    option::Option<T> push(T value) {
+        for (int spin = 0;; ++spin) {
+            if (is_closed())
+                return option::Option<T>(std::move(value));
+            if (try_push_slot(value)) {
+                wake(m_pop_waiters, m_not_empty);
+                return {};
+            }
+            if (spin >= spin_limit)
+                sleep(m_push_waiters, m_not_full, [this] { return !full(); });
+            else
+                std::this_thread::yield();
+        }
+    }
+
+    // Waits for a value. Returns None once the queue is closed and empty.
+    option::Option<T> pop() {
+        for (int spin = 0;; ++spin) {
+            option::Option<T> ret = try_pop();
+            if (ret.is_some())
+                return ret;
+            if (is_closed()) {
+                // Values pushed before close() are still drained.
+                return try_pop();
+            }
+            if (spin >= spin_limit)
+                sleep(m_pop_waiters, m_not_empty, [this] { return !empty(); });
+            else
+                std::this_thread::yield();
+        }
+    }
+
+  private:
+    static size_t round_up(size_t n) {
+        size_t ret = 2;
+        while (ret < n)
+            ret <<= 1;
+        return ret;
+    }
+
+    // Moves value into a slot if one is free; value is untouched otherwise.
+    bool try_push_slot(T &value) {
+        size_t pos = m_enqueue.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot &slot = m_slots[pos & m_mask];
+            size_t seq = slot.seq.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0) {
+                if (m_enqueue.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    new (slot.buff) T(std::move(value));
+                    slot.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    option::Option<T> try_pop_slot() {
+        size_t pos = m_dequeue.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot &slot = m_slots[pos & m_mask];
+            size_t seq = slot.seq.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos + 1);
+            if (diff == 0) {
+                if (m_dequeue.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    option::Option<T> ret(std::move(*slot.ptr()));
+                    slot.ptr()->~T();
+                    slot.seq.store(pos + m_mask + 1, std::memory_order_release);
+                    return ret;
+                }
+            } else if (diff < 0) {
+                return {};
+            } else {
+                pos = m_dequeue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool empty() const {
+        size_t pos = m_dequeue.load(std::memory_order_acquire);
+        return m_slots[pos & m_mask].seq.load(std::memory_order_acquire) !=
+               pos + 1;
+    }
+
+    bool full() const {
+        size_t pos = m_enqueue.load(std::memory_order_acquire);
+        return m_slots[pos & m_mask].seq.load(std::memory_order_acquire) !=
+               pos;
+    }
+
+    // The waiter count is published before the condition is re-checked
+    // under the mutex, and wake() reads it after publishing its change, so
+    // one of the two sides always sees the other.
+    template <typename Ready>
+    void sleep(std::atomic<int> &waiters, std::condition_variable &cv,
+               Ready ready) {
+        waiters.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            cv.wait(lock, [&] { return ready() || is_closed(); });
+        }
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void wake(std::atomic<int> &waiters, std::condition_variable &cv) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_relaxed) == 0)
+            return;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        cv.notify_one();
+    }
+
+    alignas(cache_line_size) std::atomic<size_t> m_enqueue{0};
+    alignas(cache_line_size) std::atomic<size_t> m_dequeue{0};
+
+    alignas(cache_line_size) std::atomic<bool> m_closed{false};
+    std::atomic<int> m_push_waiters{0};
+    std::atomic<int> m_pop_waiters{0};
+    std::mutex m_mutex;
+    std::condition_variable m_not_empty;
+    std::condition_variable m_not_full;
+
+    alignas(cache_line_size) const size_t m_mask;
+    std::unique_ptr<Slot[]> m_slots;
+};
+
+} // namespace sync
+} // namespace rustish
+
+#endif //_RUSTISH_SYNC_MPMC_QUEUE_HPP_
@@ -0,0 +1,78 @@
+#ifndef _RUSTISH_SYNC_PER_THREAD_HPP_
+#define _RUSTISH_SYNC_PER_THREAD_HPP_
+
+#include "../alloc/Global.hpp"
+#include "../option/Option.hpp"
+#include "CacheLine.hpp"
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace rustish {
+namespace sync {
+
+// One slot per thread, each on cache lines of its own, for threads that
+// publish results by writing only their own slot. Slots never move, so
+// threads may keep references to them. Synchronising the writers with the
+// reader (e.g. by joining them) is up to the caller.
+template <typename T> class PerThread {
+    using Slot = CachePadded<T>;
+
+  public:
+    explicit PerThread(size_t threads) : m_len(threads) {
+        m_slots = static_cast<Slot *>(
+            alloc::Global::allocate(threads * sizeof(Slot), alignof(Slot)));
+        for (size_t i = 0; i < threads; ++i)
+            new (&m_slots[i]) Slot();
+    }
+
+    PerThread(const PerThread &) = delete;
+    PerThread &operator=(const PerThread &) = delete;
+
+    ~PerThread() {
+        for (size_t i = 0; i < m_len; ++i)
+            m_slots[i].~Slot();
+        alloc::Global::deallocate(m_slots, m_len * sizeof(Slot),
+                                  alignof(Slot));
+    }
+
+    size_t len() const { return m_len; }
+
+    T &operator[](size_t index) { return m_slots[index].value; }
+
+    const T &operator[](size_t index) const { return m_slots[index].value; }
+
+    option::Option<T &> get(size_t index) {
+        if (index < m_len)
+            return option::Option<T &>(m_slots[index].value);
+        return {};
+    }
+
+    option::Option<const T &> get(size_t index) const {
+        if (index < m_len)
+            return option::Option<const T &>(m_slots[index].value);
+        return {};
+    }
+
+  private:
+    Slot *m_slots;
+    size_t m_len;
+};
+
+// Moves every Some value out of the slots, in slot order, leaving all the
+// slots None.
+template <typename T>
+std::vector<T> gather(PerThread<option::Option<T>> &slots) {
+    std::vector<T> ret;
+    for (size_t i = 0; i < slots.len(); ++i)
+        if (slots[i].is_some())
+            ret.push_back(slots[i].unwrap_unchecked());
+    return ret;
+}
+
+} // namespace sync
+} // namespace rustish
+
+#endif //_RUSTISH_SYNC_PER_THREAD_HPP_
@@ -0,0 +1,107 @@
+#ifndef _RUSTISH_SYNC_SPSC_QUEUE_HPP_
+#define _RUSTISH_SYNC_SPSC_QUEUE_HPP_
+
+#include "../option/Option.hpp"
+#include "CacheLine.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace rustish {
+namespace sync {
+
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. head and tail are free-running counters on separate cache lines;
+// each side keeps a private copy of the other side's counter and only
+// reloads it when the queue looks full (producer) or empty (consumer).
+template <typename T> class SpscQueue {
+    struct Slot {
+        alignas(T) unsigned char buff[sizeof(T)];
+
+        T *ptr() { return reinterpret_cast<T *>(buff); }
+    };
+
+  public:
+    // Capacity is rounded up to a power of two.
+    explicit SpscQueue(size_t capacity)
+        : m_mask(round_up(capacity) - 1), m_slots(new Slot[m_mask + 1]) {}
+
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    ~SpscQueue() {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        for (size_t i = m_head.load(std::memory_order_relaxed); i != tail; ++i)
+            m_slots[i & m_mask].ptr()->~T();
+    }
+
+    size_t capacity() const { return m_mask + 1; }
+
+    // Approximate when called while the other side is running.
+    size_t len() const {
+        return m_tail.load(std::memory_order_acquire) -
+               m_head.load(std::memory_order_acquire);
+    }
+
+    bool is_empty() const { return len() == 0; }
+
+    // Producer only. Returns None on success, or the value back when the
+    // queue is full.
+    option::Option<T> try_push(T value) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cached_head > m_mask) {
+            m_cached_head = m_head.load(std::memory_order_acquire);
+            if (tail - m_cached_head > m_mask)
+                return option::Option<T>(std::move(value));
+        }
+
+        new (m_slots[tail & m_mask].buff) T(std::move(value));
+        m_tail.store(tail + 1, std::memory_order_release);
+        return {};
+    }
+
+    // Consumer only. The value is moved from its slot straight into the
+    // returned Option.
+    option::Option<T> try_pop() {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cached_tail) {
+            m_cached_tail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cached_tail)
+                return {};
+        }
+
+        T *slot = m_slots[head & m_mask].ptr();
+        option::Option<T> ret(std::move(*slot));
+        slot->~T();
+        m_head.store(head + 1, std::memory_order_release);
+        return ret;
+    }
+
+  private:
+    static size_t round_up(size_t n) {
+        size_t ret = 1;
+        while (ret < n)
+            ret <<= 1;
+        return ret;
+    }
+
+    // Consumer side.
+    alignas(cache_line_size) std::atomic<size_t> m_head{0};
+    size_t m_cached_tail = 0;
+
+    // Producer side.
+    alignas(cache_line_size) std::atomic<size_t> m_tail{0};
+    size_t m_cached_head = 0;
+
+    // Shared, read-only after construction.
+    alignas(cache_line_size) const size_t m_mask;
+    std::unique_ptr<Slot[]> m_slots;
+};
+
+} // namespace sync
+} // namespace rustish
+
+#endif //_RUSTISH_SYNC_SPSC_QUEUE_HPP_
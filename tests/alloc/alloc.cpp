@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "alloc/Arena.hpp"
+#include "alloc/Global.hpp"
+#include "alloc/Pool.hpp"
+#include "alloc/ThreadCache.hpp"
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+using namespace rustish::alloc;
+
+namespace {
+
+bool aligned(void *ptr, size_t align) {
+    return reinterpret_cast<uintptr_t>(ptr) % align == 0;
+}
+
+} // namespace
+
+TEST_CASE("Global honours over-aligned requests", "[alloc]") {
+    void *ptr = Global::allocate(64, 64);
+    REQUIRE(aligned(ptr, 64));
+    Global::deallocate(ptr, 64, 64);
+}
+
+TEST_CASE("Arena hands out aligned, non-overlapping blocks", "[alloc]") {
+    Arena arena(256);
+    std::vector<char *> blocks;
+    for (size_t align : {1, 2, 4, 8, 16, 32, 64, 8, 1, 64, 64, 64}) {
+        char *ptr = static_cast<char *>(arena.allocate(24, align));
+        REQUIRE(aligned(ptr, align));
+        for (char *other : blocks)
+            REQUIRE((ptr + 24 <= other || other + 24 <= ptr));
+        blocks.push_back(ptr);
+    }
+}
+
+TEST_CASE("Arena serves requests larger than a chunk", "[alloc]") {
+    Arena arena(128);
+    char *ptr = static_cast<char *>(arena.allocate(1000, 8));
+    for (int i = 0; i < 1000; ++i)
+        ptr[i] = static_cast<char>(i);
+    REQUIRE(arena.bytes_used() >= 1000);
+}
+
+TEST_CASE("Arena reset reuses the same memory", "[alloc]") {
+    Arena arena(1024);
+    std::vector<void *> first;
+    for (int i = 0; i < 100; ++i)
+        first.push_back(arena.allocate(48, 16));
+    arena.reset();
+    REQUIRE(arena.bytes_used() == 0);
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(arena.allocate(48, 16) == first[i]);
+}
+
+TEST_CASE("Pool recycles blocks per size class", "[alloc]") {
+    Pool pool;
+    void *a = pool.allocate(24, 8);
+    void *b = pool.allocate(100, 8);
+    REQUIRE(aligned(a, Pool::granularity));
+    REQUIRE(aligned(b, Pool::granularity));
+    REQUIRE(Pool::owner_of(a) == &pool);
+    REQUIRE(Pool::owner_of(b) == &pool);
+
+    pool.deallocate(a, 24);
+    REQUIRE(pool.allocate(32, 8) == a);
+    REQUIRE(pool.allocate(24, 8) != a);
+}
+
+TEST_CASE("Pool spans many chunks", "[alloc]") {
+    Pool pool;
+    std::set<void *> seen;
+    for (int i = 0; i < 10000; ++i) {
+        void *ptr = pool.allocate(64, 16);
+        REQUIRE(Pool::owner_of(ptr) == &pool);
+        REQUIRE(seen.insert(ptr).second);
+    }
+}
+
+TEST_CASE("Pool rejects oversized requests", "[alloc]") {
+    Pool pool;
+    REQUIRE_THROWS_AS(pool.allocate(Pool::max_size + 1, 8), std::bad_alloc);
+}
+
+TEST_CASE("ThreadCache recycles blocks per size class", "[alloc]") {
+    size_t before = ThreadCache::cached();
+    void *a = ThreadCache::allocate(100, 8);
+    REQUIRE(aligned(a, alignof(std::max_align_t)));
+
+    ThreadCache::deallocate(a, 100, 8);
+    REQUIRE(ThreadCache::cached() == before + 1);
+    REQUIRE(ThreadCache::allocate(128, 8) == a);
+    REQUIRE(ThreadCache::cached() == before);
+    ThreadCache::deallocate(a, 128, 8);
+}
+
+TEST_CASE("ThreadCache bounds each free list", "[alloc]") {
+    const size_t limit = ThreadCache::max_cached;
+    size_t before = ThreadCache::cached();
+    std::vector<void *> blocks;
+    for (size_t i = 0; i < 2 * limit; ++i)
+        blocks.push_back(ThreadCache::allocate(4000, 16));
+    for (void *ptr : blocks)
+        ThreadCache::deallocate(ptr, 4000, 16);
+    REQUIRE(ThreadCache::cached() - before <= limit);
+
+    void *big = ThreadCache::allocate(ThreadCache::max_size + 1, 8);
+    ThreadCache::deallocate(big, ThreadCache::max_size + 1, 8);
+    void *over = ThreadCache::allocate(64, 64);
+    REQUIRE(aligned(over, 64));
+    ThreadCache::deallocate(over, 64, 64);
+}
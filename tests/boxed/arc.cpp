@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "alloc/Pool.hpp"
+#include "boxed/Arc.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rustish::alloc;
+using namespace rustish::boxed;
+using namespace rustish::option;
+
+namespace {
+
+struct Counted {
+    static int live;
+    int value;
+
+    explicit Counted(int v) : value(v) { ++live; }
+    Counted(const Counted &other) : value(other.value) { ++live; }
+    ~Counted() { --live; }
+};
+
+int Counted::live = 0;
+
+} // namespace
+
+TEST_CASE("Option<Arc<T>> is the size of a pointer", "[arc]") {
+    REQUIRE(sizeof(Arc<int>) == sizeof(int *));
+    REQUIRE(sizeof(Option<Arc<int>>) == sizeof(int *));
+    REQUIRE(sizeof(Option<Arc<std::string>>) == sizeof(std::string *));
+    REQUIRE(sizeof(Option<Arc<int, PoolAlloc>>) == sizeof(int *));
+}
+
+TEST_CASE("Arc shares one value between its copies", "[arc]") {
+    Arc<std::string> a = Arc<std::string>::new_(3, 'x');
+    REQUIRE(*a == "xxx");
+    REQUIRE(a.strong_count() == 1);
+
+    Arc<std::string> b = a.clone();
+    REQUIRE(Arc<std::string>::ptr_eq(a, b));
+    REQUIRE(a.as_ptr() == b.as_ptr());
+    REQUIRE(a.strong_count() == 2);
+
+    Arc<std::string> c = std::move(b);
+    REQUIRE(a.strong_count() == 2);
+
+    Arc<std::string> d = Arc<std::string>::new_("y");
+    d = c;
+    REQUIRE(a.strong_count() == 3);
+    REQUIRE(d->size() == 3);
+}
+
+TEST_CASE("Arc drops its value with the last reference", "[arc]") {
+    {
+        Arc<Counted> a = Arc<Counted>::new_(1);
+        {
+            Arc<Counted> b = a;
+            Arc<Counted> c = Arc<Counted>::new_(2);
+            REQUIRE(Counted::live == 2);
+            c = b;
+            REQUIRE(Counted::live == 1);
+        }
+        REQUIRE(Counted::live == 1);
+        REQUIRE(a.strong_count() == 1);
+    }
+    REQUIRE(Counted::live == 0);
+}
+
+TEST_CASE("Option<Arc<T>> stores None as null", "[arc]") {
+    Option<Arc<Counted>> a;
+    REQUIRE(a.is_none());
+
+    a = Arc<Counted>::new_(5);
+    Option<Arc<Counted>> b = a;
+    REQUIRE(b.as_ref().unwrap().strong_count() == 2);
+    REQUIRE(b.take().unwrap()->value == 5);
+    REQUIRE(b.is_none());
+    REQUIRE(a.as_ref().unwrap().strong_count() == 1);
+
+    a = None();
+    REQUIRE(Counted::live == 0);
+}
+
+TEST_CASE("Arc references may be dropped on any thread", "[arc]") {
+    {
+        Arc<Counted> a = Arc<Counted>::new_(1);
+        std::atomic<int> sum{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([a, &sum] {
+                for (int i = 0; i < 10000; ++i) {
+                    Arc<Counted> b = a;
+                    sum.fetch_add(b->value, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (std::thread &t : threads)
+            t.join();
+        REQUIRE(sum.load() == 40000);
+        REQUIRE(a.strong_count() == 1);
+    }
+    REQUIRE(Counted::live == 0);
+}
@@ -0,0 +1,138 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "alloc/Arena.hpp"
+#include "alloc/Pool.hpp"
+#include "boxed/Box.hpp"
+
+#include <memory>
+#include <string>
+
+using namespace rustish::alloc;
+using namespace rustish::boxed;
+using namespace rustish::option;
+
+namespace {
+
+struct Counted {
+    static int live;
+    int value;
+
+    explicit Counted(int v) : value(v) { ++live; }
+    Counted(const Counted &other) : value(other.value) { ++live; }
+    ~Counted() { --live; }
+};
+
+int Counted::live = 0;
+
+} // namespace
+
+TEST_CASE("Option<Box<T>> is the size of a pointer", "[box]") {
+    REQUIRE(sizeof(Box<int>) == sizeof(int *));
+    REQUIRE(sizeof(Option<Box<int>>) == sizeof(int *));
+    REQUIRE(sizeof(Option<Box<std::string>>) == sizeof(std::string *));
+    REQUIRE(sizeof(Option<Box<int, ArenaAlloc>>) == sizeof(int *));
+    REQUIRE(sizeof(Option<Box<int, PoolAlloc>>) == sizeof(int *));
+}
+
+TEST_CASE("new_ constructs the value in place", "[box]") {
+    Box<std::string> b = Box<std::string>::new_(3, 'x');
+    REQUIRE(*b == "xxx");
+    REQUIRE(b->size() == 3);
+}
+
+TEST_CASE("Box destroys its value", "[box]") {
+    {
+        Box<Counted> b = Box<Counted>::new_(1);
+        REQUIRE(Counted::live == 1);
+        Box<Counted> c = std::move(b);
+        REQUIRE(Counted::live == 1);
+        REQUIRE(c->value == 1);
+    }
+    REQUIRE(Counted::live == 0);
+}
+
+TEST_CASE("into_inner moves the value out", "[box]") {
+    Box<std::string> b = Box<std::string>::new_("hello");
+    std::string s = b.into_inner();
+    REQUIRE(s == "hello");
+}
+
+TEST_CASE("Option<Box<T>> defaults to None", "[box]") {
+    Option<Box<int>> opt;
+    REQUIRE(opt.is_none());
+    REQUIRE(!opt.is_some());
+
+    Option<Box<int>> none = None();
+    REQUIRE(none.is_none());
+}
+
+TEST_CASE("Option<Box<T>> holds a Box", "[box]") {
+    Option<Box<int>> opt = Some(Box<int>::new_(5));
+    REQUIRE(opt.is_some());
+    REQUIRE(*opt.as_ref().unwrap() == 5);
+
+    SECTION("unwrap moves the Box out") {
+        Box<int> b = opt.unwrap();
+        REQUIRE(*b == 5);
+        REQUIRE(opt.is_none());
+    }
+
+    SECTION("take leaves None behind") {
+        Option<Box<int>> taken = opt.take();
+        REQUIRE(opt.is_none());
+        REQUIRE(taken.is_some());
+        REQUIRE(*taken.unwrap() == 5);
+    }
+
+    SECTION("map reads through the Box") {
+        Option<int> doubled = opt.map([](Box<int> &&b) { return *b * 2; });
+        REQUIRE(doubled.unwrap() == 10);
+    }
+}
+
+TEST_CASE("Option<Box<T>> destroys its value exactly once", "[box]") {
+    {
+        Option<Box<Counted>> a = Some(Box<Counted>::new_(1));
+        Option<Box<Counted>> b = std::move(a);
+        REQUIRE(a.is_none());
+        REQUIRE(Counted::live == 1);
+        b.insert(Box<Counted>::new_(2));
+        REQUIRE(Counted::live == 1);
+        REQUIRE(b.as_ref().unwrap()->value == 2);
+    }
+    REQUIRE(Counted::live == 0);
+}
+
+TEST_CASE("Box can be allocated from an Arena", "[box]") {
+    Arena arena;
+    {
+        Box<Counted, ArenaAlloc> a =
+            Box<Counted, ArenaAlloc>::new_in(arena, 1);
+        Box<Counted, ArenaAlloc> b =
+            Box<Counted, ArenaAlloc>::new_in(arena, 2);
+        REQUIRE(a->value == 1);
+        REQUIRE(b->value == 2);
+        REQUIRE(arena.bytes_used() >= 2 * sizeof(Counted));
+    }
+    REQUIRE(Counted::live == 0);
+
+    SECTION("leaked values are reclaimed by reset") {
+        Box<int, ArenaAlloc>::new_in(arena, 3).leak();
+        arena.reset();
+        REQUIRE(arena.bytes_used() == 0);
+    }
+}
+
+TEST_CASE("Box can be allocated from a Pool", "[box]") {
+    Pool pool;
+    Option<Box<Counted, PoolAlloc>> a =
+        Some(Box<Counted, PoolAlloc>::new_in(pool, 1));
+    Counted *first = a.as_ref().unwrap().as_ptr();
+    a.take();
+    REQUIRE(Counted::live == 0);
+
+    // The freed block is reused for the next value of the same size class.
+    Box<Counted, PoolAlloc> b = Box<Counted, PoolAlloc>::new_in(pool, 2);
+    REQUIRE(b.as_ptr() == first);
+    REQUIRE(b->value == 2);
+}
@@ -0,0 +1,200 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "codec/Decoder.hpp"
+#include "codec/Encoder.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace rustish::codec;
+using namespace rustish::option;
+
+namespace {
+
+// 8 byte aligned scratch buffer so raw payloads can be referenced in place.
+struct Buffer {
+    std::vector<uint64_t> words;
+
+    explicit Buffer(size_t bytes) : words((bytes + 7) / 8) {}
+
+    uint8_t *data() { return reinterpret_cast<uint8_t *>(words.data()); }
+};
+
+} // namespace
+
+TEST_CASE("varints round trip", "[codec]") {
+    Buffer buf(256);
+    Encoder enc(buf.data(), 256);
+    const uint64_t values[] = {0, 1, 127, 128, 300, 1ull << 35, UINT64_MAX};
+    for (uint64_t v : values)
+        enc.write(v);
+    enc.write(int64_t(-1));
+    enc.write(int32_t(std::numeric_limits<int32_t>::min()));
+    REQUIRE(enc.ok());
+
+    Decoder dec(buf.data(), enc.len());
+    for (uint64_t v : values)
+        REQUIRE(dec.read<uint64_t>().unwrap() == v);
+    REQUIRE(dec.read<int64_t>().unwrap() == -1);
+    REQUIRE(dec.read<int32_t>().unwrap() == std::numeric_limits<int32_t>::min());
+    REQUIRE(dec.ok());
+    REQUIRE(dec.remaining() == 0);
+}
+
+TEST_CASE("small values take one byte", "[codec]") {
+    Buffer buf(16);
+    Encoder enc(buf.data(), 16);
+    enc.write(uint32_t(5));
+    enc.write(int32_t(-3));
+    REQUIRE(enc.len() == 2);
+}
+
+TEST_CASE("Option fields share one presence bitmap", "[codec]") {
+    Buffer buf(64);
+    Encoder enc(buf.data(), 64);
+    enc.begin_options(4);
+    enc.write_option(Option<uint32_t>(7u));
+    enc.write_option(Option<uint32_t>());
+    enc.write_option(Option<double>(2.5));
+    enc.write_option(Option<bool>(false));
+    REQUIRE(enc.ok());
+    // 1 bitmap byte, 1 varint byte, 8 double bytes, 1 bool byte.
+    REQUIRE(enc.len() == 11);
+
+    Decoder dec(buf.data(), enc.len());
+    dec.begin_options(4);
+    REQUIRE(dec.read_option<uint32_t>().unwrap() == 7);
+    REQUIRE(dec.read_option<uint32_t>().is_none());
+    REQUIRE(dec.read_option<double>().unwrap() == 2.5);
+    REQUIRE(dec.read_option<bool>().unwrap() == false);
+    REQUIRE(dec.ok());
+}
+
+TEST_CASE("Option columns round trip", "[codec]") {
+    std::vector<Option<int64_t>> column;
+    for (int64_t i = 0; i < 100; ++i) {
+        if (i % 3 == 0)
+            column.push_back(None());
+        else
+            column.push_back(Option<int64_t>(i * 1000 - 50000));
+    }
+
+    Buffer buf(1024);
+    Encoder enc(buf.data(), 1024);
+    enc.write_option_column(column.data(), column.size());
+    REQUIRE(enc.ok());
+
+    std::vector<Option<int64_t>> decoded(column.size());
+    Decoder dec(buf.data(), enc.len());
+    dec.read_option_column(decoded.data(), decoded.size());
+    REQUIRE(dec.ok());
+    for (size_t i = 0; i < column.size(); ++i) {
+        REQUIRE(decoded[i].is_some() == column[i].is_some());
+        if (column[i].is_some())
+            REQUIRE(decoded[i].as_ref().unwrap() ==
+                    column[i].as_ref().unwrap());
+    }
+}
+
+TEST_CASE("raw Options decode as references into the input", "[codec]") {
+    struct Point {
+        double x, y;
+    };
+
+    Buffer buf(64);
+    Encoder enc(buf.data(), 64);
+    enc.write(uint8_t(1));
+    enc.begin_options(2);
+    enc.write_option_raw(Option<Point>(Point{1.0, 2.0}));
+    enc.write_option_raw(Option<Point>());
+    REQUIRE(enc.ok());
+
+    Decoder dec(buf.data(), enc.len());
+    REQUIRE(dec.read<uint8_t>().unwrap() == 1);
+    dec.begin_options(2);
+    Option<const Point &> p = dec.read_option_ref<Point>();
+    REQUIRE(dec.read_option_ref<Point>().is_none());
+    REQUIRE(dec.ok());
+
+    const Point &ref = p.unwrap();
+    REQUIRE(ref.x == 1.0);
+    REQUIRE(ref.y == 2.0);
+    const uint8_t *addr = reinterpret_cast<const uint8_t *>(&ref);
+    REQUIRE(addr >= buf.data());
+    REQUIRE(addr < buf.data() + enc.len());
+}
+
+TEST_CASE("Encoder reports running out of space", "[codec]") {
+    uint8_t small[3];
+    Encoder enc(small, sizeof(small));
+    enc.write(uint64_t(1) << 40);
+    REQUIRE(!enc.ok());
+    enc.write(uint8_t(1));
+    REQUIRE(!enc.ok());
+}
+
+TEST_CASE("Option groups past the end of the buffer are dropped",
+          "[codec]") {
+    uint8_t small[4];
+    Encoder enc(small, sizeof(small));
+    for (uint64_t i = 0; i < 4; ++i)
+        enc.write(i);
+    REQUIRE(enc.ok());
+    REQUIRE(enc.len() == 4);
+
+    const Option<uint64_t> column[] = {Some(uint64_t(1)), None(),
+                                       Some(uint64_t(3))};
+    enc.write_option_column(column, 3);
+    REQUIRE(!enc.ok());
+    REQUIRE(enc.len() == 4);
+
+    // A later group still starts cleanly and is dropped the same way.
+    enc.begin_options(1);
+    enc.write_option(Some(true));
+    REQUIRE(!enc.ok());
+    REQUIRE(enc.len() == 4);
+
+    // Failing a large reservation leaves room that must not be written.
+    std::vector<uint8_t> big(64);
+    Encoder roomy(big.data(), big.size());
+    roomy.begin_options(1000);
+    REQUIRE(!roomy.ok());
+    roomy.write_option(Some(uint64_t(7)));
+    roomy.write(uint64_t(7));
+    REQUIRE(roomy.len() == 0);
+}
+
+TEST_CASE("Decoder rejects truncated or malformed input", "[codec]") {
+    SECTION("truncated varint") {
+        const uint8_t data[] = {0x80, 0x80};
+        Decoder dec(data, sizeof(data));
+        REQUIRE(dec.read<uint64_t>().is_none());
+        REQUIRE(!dec.ok());
+    }
+
+    SECTION("value out of range for the type") {
+        const uint8_t data[] = {0xAC, 0x02};
+        Decoder dec(data, sizeof(data));
+        REQUIRE(dec.read<uint8_t>().is_none());
+        REQUIRE(!dec.ok());
+    }
+
+    SECTION("errors are sticky") {
+        const uint8_t data[] = {0x02, 0x05};
+        Decoder dec(data, sizeof(data));
+        REQUIRE(dec.read<bool>().is_none());
+        REQUIRE(dec.read<uint8_t>().is_none());
+        REQUIRE(!dec.ok());
+    }
+
+    SECTION("more Options than the presence group declared") {
+        const uint8_t data[] = {0x00};
+        Decoder dec(data, sizeof(data));
+        dec.begin_options(1);
+        REQUIRE(dec.read_option<uint32_t>().is_none());
+        REQUIRE(dec.ok());
+        REQUIRE(dec.read_option<uint32_t>().is_none());
+        REQUIRE(!dec.ok());
+    }
+}
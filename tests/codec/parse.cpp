@@ -0,0 +1,132 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "codec/Parse.hpp"
+#include "collections/Vec.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+
+using namespace rustish::codec;
+using namespace rustish::option;
+
+namespace {
+
+template <typename T> Option<T> parse_str(const std::string &str) {
+    return parse<T>(str.data(), str.data() + str.size());
+}
+
+} // namespace
+
+TEST_CASE("parse reads decimal integers", "[parse]") {
+    REQUIRE(parse<int>("0").unwrap() == 0);
+    REQUIRE(parse<int>("42").unwrap() == 42);
+    REQUIRE(parse<int>("-42").unwrap() == -42);
+    REQUIRE(parse<int>("+42").unwrap() == 42);
+    REQUIRE(parse<int>("-0").unwrap() == 0);
+    REQUIRE(parse<int>("0000000000000000000000000007").unwrap() == 7);
+    REQUIRE(parse<unsigned>("+7").unwrap() == 7u);
+
+    std::string s = "123";
+    REQUIRE(parse<long>(s).unwrap() == 123);
+}
+
+TEST_CASE("parse rejects anything but a whole number", "[parse]") {
+    const char *bad[] = {"",   "+",    "-",     " 1", "1 ", "1a",
+                         "a1", "--1",  "+-1",   "1.", "0x10", "1,000",
+                         "1\n", "12345678a", "1234567812345678/"};
+    for (const char *str : bad)
+        REQUIRE(parse<int64_t>(str).is_none());
+
+    REQUIRE(parse<unsigned>("-1").is_none());
+    REQUIRE(parse<unsigned>("-0").is_none());
+}
+
+TEST_CASE("parse checks the range of the target type", "[parse]") {
+    REQUIRE(parse<int8_t>("127").unwrap() == 127);
+    REQUIRE(parse<int8_t>("-128").unwrap() == -128);
+    REQUIRE(parse<int8_t>("128").is_none());
+    REQUIRE(parse<int8_t>("-129").is_none());
+    REQUIRE(parse<uint8_t>("255").unwrap() == 255);
+    REQUIRE(parse<uint8_t>("256").is_none());
+
+    REQUIRE(parse<int64_t>("9223372036854775807").unwrap() == INT64_MAX);
+    REQUIRE(parse<int64_t>("-9223372036854775808").unwrap() == INT64_MIN);
+    REQUIRE(parse<int64_t>("9223372036854775808").is_none());
+    REQUIRE(parse<int64_t>("-9223372036854775809").is_none());
+
+    REQUIRE(parse<uint64_t>("18446744073709551615").unwrap() == UINT64_MAX);
+    REQUIRE(parse<uint64_t>("18446744073709551616").is_none());
+    REQUIRE(parse<uint64_t>("99999999999999999999").is_none());
+    REQUIRE(parse<uint64_t>("100000000000000000000").is_none());
+}
+
+// Every length from 1 to 20 digits, so each mix of 8 digit chunks and tail
+// digits is covered, checked against snprintf.
+TEST_CASE("parse agrees with printing at every length", "[parse]") {
+    uint64_t value = 0;
+    for (int len = 1; len <= 20; ++len) {
+        value = value * 10 + static_cast<uint64_t>(len % 10);
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%llu",
+                      static_cast<unsigned long long>(value));
+        REQUIRE(parse_str<uint64_t>(buf).unwrap() == value);
+
+        std::string bad = buf;
+        for (size_t i = 0; i < bad.size(); ++i) {
+            std::string copy = bad;
+            copy[i] = ':';
+            REQUIRE(parse_str<uint64_t>(copy).is_none());
+            copy[i] = '/';
+            REQUIRE(parse_str<uint64_t>(copy).is_none());
+        }
+    }
+}
+
+TEST_CASE("parse reads floating point", "[parse]") {
+    REQUIRE(parse<double>("1.5").unwrap() == 1.5);
+    REQUIRE(parse<double>("-0.25").unwrap() == -0.25);
+    REQUIRE(parse<double>("+2").unwrap() == 2.0);
+    REQUIRE(parse<double>("1e3").unwrap() == 1000.0);
+    REQUIRE(parse<float>("0.5").unwrap() == 0.5f);
+    REQUIRE(parse<double>("inf").unwrap() ==
+            std::numeric_limits<double>::infinity());
+
+    const char *bad[] = {"", "+", "+-1", " 1.5", "1.5 ", "1.5x", "0x1p3",
+                         "e5", "1e400"};
+    for (const char *str : bad)
+        REQUIRE(parse<double>(str).is_none());
+}
+
+TEST_CASE("parse reads bool", "[parse]") {
+    REQUIRE(parse<bool>("true").unwrap());
+    REQUIRE(!parse<bool>("false").unwrap());
+    REQUIRE(parse<bool>("True").is_none());
+    REQUIRE(parse<bool>("1").is_none());
+}
+
+TEST_CASE("parse_delimited fills a nullable column", "[parse]") {
+    const std::string csv = "1,-2,,x,9223372036854775807,5,";
+    rustish::collections::Vec<Option<int64_t>> column;
+    REQUIRE(parse_delimited<int64_t>(csv.data(), csv.size(), ',', column) ==
+            6);
+    REQUIRE(column.len() == 6);
+    REQUIRE(column[0].unwrap() == 1);
+    REQUIRE(column[1].unwrap() == -2);
+    REQUIRE(column[2].is_none());
+    REQUIRE(column[3].is_none());
+    REQUIRE(column[4].unwrap() == INT64_MAX);
+    REQUIRE(column[5].unwrap() == 5);
+
+    // Only the trailing delimiter is dropped; a final empty field between
+    // two delimiters is still there.
+    const std::string lines = "0.5\n\n";
+    rustish::collections::Vec<Option<double>> doubles;
+    REQUIRE(parse_delimited<double>(lines.data(), lines.size(), '\n',
+                                    doubles) == 2);
+    REQUIRE(doubles[0].unwrap() == 0.5);
+    REQUIRE(doubles[1].is_none());
+
+    REQUIRE(parse_delimited<double>(lines.data(), 0, '\n', doubles) == 0);
+}
@@ -0,0 +1,195 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "collections/HashMap.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+using namespace rustish::collections;
+using namespace rustish::option;
+
+namespace {
+
+// Value whose constructor throws when asked to; live counts the objects
+// that were actually built.
+struct MayThrow {
+    static int live;
+
+    MayThrow(bool fail) {
+        if (fail)
+            throw std::runtime_error("fail");
+        ++live;
+    }
+    MayThrow(MayThrow &&) { ++live; }
+    MayThrow &operator=(MayThrow &&) = default;
+    ~MayThrow() { --live; }
+};
+
+int MayThrow::live = 0;
+
+} // namespace
+
+TEST_CASE("HashMap default constructor is empty", "[hash-map]") {
+    HashMap<int, int> map;
+    REQUIRE(map.is_empty());
+    REQUIRE(map.len() == 0);
+    REQUIRE(map.get(5).is_none());
+    REQUIRE(!map.contains_key(5));
+}
+
+TEST_CASE("insert returns None for a new key", "[hash-map]") {
+    HashMap<int, int> map;
+    Option<int> old = map.insert(1, 10);
+    REQUIRE(old.is_none());
+    REQUIRE(map.len() == 1);
+    REQUIRE(map.contains_key(1));
+}
+
+TEST_CASE("insert returns the previous value for an existing key",
+          "[hash-map]") {
+    HashMap<int, std::string> map;
+    map.insert(1, std::string("one"));
+    Option<std::string> old = map.insert(1, std::string("uno"));
+    REQUIRE(old.is_some());
+    REQUIRE(old.unwrap_unchecked() == "one");
+    REQUIRE(map.len() == 1);
+    REQUIRE(map.get(1).unwrap() == "uno");
+}
+
+TEST_CASE("get returns a reference to the stored value", "[hash-map]") {
+    HashMap<int, int> map;
+    map.insert(1, 10);
+
+    SECTION("key is present") {
+        Option<int &> val = map.get(1);
+        REQUIRE(val.is_some());
+        val.unwrap() = 11;
+        REQUIRE(map.get(1).unwrap() == 11);
+    }
+
+    SECTION("key is missing") { REQUIRE(map.get(2).is_none()); }
+
+    SECTION("const map") {
+        const HashMap<int, int> &cmap = map;
+        Option<const int &> val = cmap.get(1);
+        REQUIRE(val.is_some());
+        REQUIRE(val.unwrap() == 10);
+        REQUIRE(cmap.get(2).is_none());
+    }
+}
+
+TEST_CASE("remove returns the removed value", "[hash-map]") {
+    HashMap<std::string, std::string> map;
+    map.insert(std::string("a"), std::string("alpha"));
+
+    SECTION("key is present") {
+        Option<std::string> val = map.remove("a");
+        REQUIRE(val.is_some());
+        REQUIRE(val.unwrap_unchecked() == "alpha");
+        REQUIRE(map.is_empty());
+        REQUIRE(map.get("a").is_none());
+    }
+
+    SECTION("key is missing") {
+        REQUIRE(map.remove("b").is_none());
+        REQUIRE(map.len() == 1);
+    }
+}
+
+TEST_CASE("HashMap grows past many groups", "[hash-map]") {
+    HashMap<int, int> map;
+    for (int i = 0; i < 10000; ++i)
+        REQUIRE(map.insert(i, i * 2).is_none());
+
+    REQUIRE(map.len() == 10000);
+    REQUIRE(map.capacity() >= 10000);
+    for (int i = 0; i < 10000; ++i)
+        REQUIRE(map.get(i).unwrap() == i * 2);
+    REQUIRE(map.get(10000).is_none());
+}
+
+TEST_CASE("HashMap matches std::unordered_map under insert/remove churn",
+          "[hash-map]") {
+    HashMap<uint64_t, uint64_t> map;
+    std::unordered_map<uint64_t, uint64_t> expected;
+
+    uint64_t state = 12345;
+    for (int i = 0; i < 200000; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t key = (state >> 33) % 4096;
+        if ((state >> 20) & 1) {
+            Option<uint64_t> old = map.insert(key, state);
+            auto it = expected.find(key);
+            REQUIRE(old.is_some() == (it != expected.end()));
+            if (it != expected.end())
+                REQUIRE(old.unwrap_unchecked() == it->second);
+            expected[key] = state;
+        } else {
+            Option<uint64_t> old = map.remove(key);
+            auto it = expected.find(key);
+            REQUIRE(old.is_some() == (it != expected.end()));
+            if (it != expected.end()) {
+                REQUIRE(old.unwrap_unchecked() == it->second);
+                expected.erase(it);
+            }
+        }
+    }
+
+    REQUIRE(map.len() == expected.size());
+    size_t visited = 0;
+    map.for_each([&](const uint64_t &key, uint64_t &value) {
+        REQUIRE(expected.at(key) == value);
+        ++visited;
+    });
+    REQUIRE(visited == expected.size());
+}
+
+TEST_CASE("reserve avoids reallocation", "[hash-map]") {
+    HashMap<int, int> map;
+    map.reserve(1000);
+    size_t cap = map.capacity();
+    REQUIRE(cap >= 1000);
+    for (int i = 0; i < 1000; ++i)
+        map.insert(i, i);
+    REQUIRE(map.capacity() == cap);
+}
+
+TEST_CASE("clear removes every entry", "[hash-map]") {
+    HashMap<int, std::string> map;
+    for (int i = 0; i < 100; ++i)
+        map.insert(i, std::to_string(i));
+    map.clear();
+    REQUIRE(map.is_empty());
+    REQUIRE(map.get(1).is_none());
+    map.insert(1, std::string("1"));
+    REQUIRE(map.get(1).unwrap() == "1");
+}
+
+TEST_CASE("HashMap move constructor takes ownership", "[hash-map]") {
+    HashMap<int, int> a;
+    a.insert(1, 1);
+    HashMap<int, int> b(std::move(a));
+    REQUIRE(a.is_empty());
+    REQUIRE(b.get(1).unwrap() == 1);
+}
+
+TEST_CASE("a throwing insert leaves the map unchanged", "[hash-map]") {
+    {
+        HashMap<int, MayThrow> map;
+        for (int i = 0; i < 20; ++i)
+            map.insert(i, false);
+        REQUIRE(MayThrow::live == 20);
+
+        for (int i = 20; i < 40; ++i)
+            REQUIRE_THROWS_AS(map.insert(i, true), std::runtime_error);
+        REQUIRE(map.len() == 20);
+        REQUIRE(map.get(20).is_none());
+        REQUIRE(MayThrow::live == 20);
+
+        map.insert(20, false);
+        REQUIRE(map.len() == 21);
+        REQUIRE(map.get(20).is_some());
+    }
+    REQUIRE(MayThrow::live == 0);
+}
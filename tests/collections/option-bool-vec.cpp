@@ -0,0 +1,88 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "collections/OptionBoolVec.hpp"
+
+using namespace rustish::collections;
+using namespace rustish::option;
+
+namespace {
+
+Option<bool> pattern(size_t i) {
+    switch (i % 3) {
+    case 0:
+        return None();
+    case 1:
+        return Some(true);
+    default:
+        return Some(false);
+    }
+}
+
+} // namespace
+
+TEST_CASE("OptionBoolVec starts empty", "[option-bool-vec]") {
+    OptionBoolVec vec;
+    REQUIRE(vec.is_empty());
+    REQUIRE(vec.len() == 0);
+    REQUIRE(vec.pop().is_none());
+}
+
+TEST_CASE("OptionBoolVec stores all three states", "[option-bool-vec]") {
+    OptionBoolVec vec;
+    for (size_t i = 0; i < 200; ++i)
+        vec.push(pattern(i));
+
+    REQUIRE(vec.len() == 200);
+    for (size_t i = 0; i < 200; ++i) {
+        Option<bool> expected = pattern(i);
+        Option<bool> actual = vec.get(i);
+        REQUIRE(actual.is_some() == expected.is_some());
+        if (expected.is_some())
+            REQUIRE(actual.unwrap() == expected.unwrap());
+    }
+}
+
+TEST_CASE("OptionBoolVec counts each state", "[option-bool-vec]") {
+    OptionBoolVec vec;
+    for (size_t i = 0; i < 300; ++i)
+        vec.push(pattern(i));
+
+    REQUIRE(vec.count_none() == 100);
+    REQUIRE(vec.count_some() == 200);
+    REQUIRE(vec.count_true() == 100);
+    REQUIRE(vec.count_false() == 100);
+}
+
+TEST_CASE("OptionBoolVec set overwrites an element", "[option-bool-vec]") {
+    OptionBoolVec vec(10);
+    REQUIRE(vec.count_none() == 10);
+
+    vec.set(3, Some(true));
+    REQUIRE(vec.get(3).unwrap() == true);
+    vec.set(3, Some(false));
+    REQUIRE(vec.get(3).unwrap() == false);
+    vec.set(3, None());
+    REQUIRE(vec.get(3).is_none());
+    REQUIRE(vec.count_true() == 0);
+}
+
+TEST_CASE("OptionBoolVec pop and resize drop trailing elements",
+          "[option-bool-vec]") {
+    OptionBoolVec vec;
+    for (size_t i = 0; i < 70; ++i)
+        vec.push(Some(true));
+
+    REQUIRE(vec.pop().unwrap() == true);
+    REQUIRE(vec.len() == 69);
+
+    vec.resize(10);
+    REQUIRE(vec.count_true() == 10);
+    vec.resize(100);
+    REQUIRE(vec.count_true() == 10);
+    REQUIRE(vec.count_none() == 90);
+}
+
+TEST_CASE("OptionBoolVec uses two bits per element", "[option-bool-vec]") {
+    OptionBoolVec vec(64 * 1000);
+    REQUIRE(vec.heap_bytes() == 2 * 8 * 1000);
+}
@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "collections/SlotMap.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace rustish::collections;
+using namespace rustish::option;
+
+TEST_CASE("SlotMap default constructor is empty", "[slot-map]") {
+    SlotMap<int> map;
+    REQUIRE(map.is_empty());
+    REQUIRE(map.len() == 0);
+    REQUIRE(map.get(SlotKey{0, 1}).is_none());
+}
+
+TEST_CASE("get returns the inserted value", "[slot-map]") {
+    SlotMap<std::string> map;
+    SlotKey a = map.insert(std::string("a"));
+    SlotKey b = map.insert(std::string("b"));
+    REQUIRE(a != b);
+    REQUIRE(map.len() == 2);
+    REQUIRE(map.get(a).unwrap() == "a");
+    REQUIRE(map.get(b).unwrap() == "b");
+
+    SECTION("value can be modified through the reference") {
+        map.get(a).unwrap() = "c";
+        REQUIRE(map.get(a).unwrap() == "c");
+    }
+
+    SECTION("const map") {
+        const SlotMap<std::string> &cmap = map;
+        Option<const std::string &> val = cmap.get(b);
+        REQUIRE(val.is_some());
+        REQUIRE(val.unwrap() == "b");
+    }
+}
+
+TEST_CASE("remove returns the value and invalidates the key", "[slot-map]") {
+    SlotMap<std::string> map;
+    SlotKey a = map.insert(std::string("a"));
+    SlotKey b = map.insert(std::string("b"));
+
+    Option<std::string> val = map.remove(a);
+    REQUIRE(val.is_some());
+    REQUIRE(val.unwrap_unchecked() == "a");
+    REQUIRE(map.len() == 1);
+    REQUIRE(map.get(a).is_none());
+    REQUIRE(!map.contains_key(a));
+    REQUIRE(map.remove(a).is_none());
+    REQUIRE(map.get(b).unwrap() == "b");
+}
+
+TEST_CASE("stale key does not see a reused slot", "[slot-map]") {
+    SlotMap<int> map;
+    SlotKey a = map.insert(1);
+    map.remove(a);
+    SlotKey b = map.insert(2);
+    REQUIRE(b.index == a.index);
+    REQUIRE(b.version != a.version);
+    REQUIRE(map.get(a).is_none());
+    REQUIRE(map.remove(a).is_none());
+    REQUIRE(map.get(b).unwrap() == 2);
+}
+
+TEST_CASE("removing from the middle keeps the other keys valid",
+          "[slot-map]") {
+    SlotMap<int> map;
+    std::vector<SlotKey> keys;
+    for (int i = 0; i < 100; ++i)
+        keys.push_back(map.insert(i));
+
+    for (int i = 0; i < 100; i += 3)
+        REQUIRE(map.remove(keys[i]).unwrap() == i);
+
+    for (int i = 0; i < 100; ++i) {
+        if (i % 3 == 0)
+            REQUIRE(map.get(keys[i]).is_none());
+        else
+            REQUIRE(map.get(keys[i]).unwrap() == i);
+    }
+}
+
+TEST_CASE("iteration visits every live value once", "[slot-map]") {
+    SlotMap<int> map;
+    std::vector<SlotKey> keys;
+    for (int i = 0; i < 10; ++i)
+        keys.push_back(map.insert(i));
+    map.remove(keys[2]);
+    map.remove(keys[7]);
+
+    std::vector<int> seen(map.begin(), map.end());
+    std::sort(seen.begin(), seen.end());
+    REQUIRE(seen == std::vector<int>{0, 1, 3, 4, 5, 6, 8, 9});
+
+    map.for_each([&](SlotKey key, int &value) {
+        REQUIRE(key == keys[value]);
+    });
+}
+
+TEST_CASE("clear invalidates every key", "[slot-map]") {
+    SlotMap<int> map;
+    SlotKey a = map.insert(1);
+    SlotKey b = map.insert(2);
+    map.clear();
+    REQUIRE(map.is_empty());
+    REQUIRE(map.get(a).is_none());
+    REQUIRE(map.get(b).is_none());
+
+    SlotKey c = map.insert(3);
+    REQUIRE(map.get(c).unwrap() == 3);
+    REQUIRE(map.len() == 1);
+}
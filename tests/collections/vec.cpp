@@ -0,0 +1,250 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "collections/Vec.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+using namespace rustish::collections;
+using namespace rustish::option;
+
+namespace {
+
+struct Counted {
+    static int live;
+    static int copies;
+
+    explicit Counted(int v) : value(v) { ++live; }
+    Counted(const Counted &other) : value(other.value) {
+        ++live;
+        ++copies;
+    }
+    Counted(Counted &&other) noexcept : value(other.value) { ++live; }
+    ~Counted() { --live; }
+
+    int value;
+};
+
+int Counted::live = 0;
+int Counted::copies = 0;
+
+// Moves throw while fail is set.
+struct MoveThrows {
+    static int live;
+    static bool fail;
+
+    explicit MoveThrows(int v) : value(v) { ++live; }
+    MoveThrows(MoveThrows &&other) : value(other.value) {
+        if (fail)
+            throw std::runtime_error("move");
+        ++live;
+    }
+    ~MoveThrows() { --live; }
+
+    int value;
+};
+
+int MoveThrows::live = 0;
+bool MoveThrows::fail = false;
+
+struct Base {
+    int x;
+};
+
+struct Derived : Base {
+    int y;
+};
+
+static_assert(std::is_convertible<Slice<int>, Slice<const int>>::value,
+              "a Slice converts to its read-only view");
+static_assert(!std::is_convertible<Slice<const int>, Slice<int>>::value,
+              "a read-only Slice does not become mutable");
+static_assert(!std::is_convertible<Slice<Derived>, Slice<Base>>::value,
+              "a Slice of derived elements is not a Slice of bases");
+static_assert(!std::is_constructible<Slice<Base>, Slice<Derived>>::value,
+              "a Slice of derived elements is not a Slice of bases");
+
+static_assert(std::is_nothrow_move_constructible<Vec<MoveThrows>>::value &&
+                  std::is_nothrow_move_assignable<Vec<MoveThrows>>::value,
+              "moving a Vec only moves its pointer");
+static_assert(
+    std::is_nothrow_move_constructible<SmallVec<Counted, 4>>::value &&
+        std::is_nothrow_move_assignable<SmallVec<Counted, 4>>::value,
+    "a SmallVec moves without throwing when its elements do");
+static_assert(
+    !std::is_nothrow_move_constructible<SmallVec<MoveThrows, 4>>::value,
+    "moving inline elements may throw");
+
+} // namespace
+
+TEST_CASE("Vec is a pointer, a length and a capacity", "[vec]") {
+    REQUIRE(sizeof(Vec<int>) == 3 * sizeof(void *));
+    REQUIRE(sizeof(SmallVec<int, 8>) >= 3 * sizeof(void *) + 8 * sizeof(int));
+}
+
+TEST_CASE("Vec accessors return None when out of range", "[vec]") {
+    Vec<int> vec;
+    REQUIRE(vec.is_empty());
+    REQUIRE(vec.get(0).is_none());
+    REQUIRE(vec.first().is_none());
+    REQUIRE(vec.last().is_none());
+    REQUIRE(vec.split_first().is_none());
+    REQUIRE(vec.split_last().is_none());
+    REQUIRE(vec.pop().is_none());
+
+    vec = {1, 2, 3};
+    REQUIRE(vec.len() == 3);
+    REQUIRE(vec.get(2).unwrap() == 3);
+    REQUIRE(vec.get(3).is_none());
+    REQUIRE(vec.get(size_t(-1)).is_none());
+    REQUIRE(vec.first().unwrap() == 1);
+    REQUIRE(vec.last().unwrap() == 3);
+
+    vec.get(1).unwrap() = 20;
+    REQUIRE(vec[1] == 20);
+
+    const Vec<int> &cvec = vec;
+    REQUIRE(cvec.get(1).unwrap() == 20);
+    REQUIRE(cvec.last().unwrap() == 3);
+}
+
+TEST_CASE("split_first and split_last return an element and the rest",
+          "[vec]") {
+    Vec<int> vec = {1, 2, 3};
+
+    std::pair<int &, Slice<int>> head = vec.split_first().unwrap();
+    REQUIRE(head.first == 1);
+    REQUIRE(head.second.len() == 2);
+    REQUIRE(head.second.first().unwrap() == 2);
+
+    std::pair<const int &, Slice<const int>> tail =
+        static_cast<const Vec<int> &>(vec).split_last().unwrap();
+    REQUIRE(tail.first == 3);
+    REQUIRE(tail.second.len() == 2);
+    REQUIRE(tail.second.last().unwrap() == 2);
+
+    int sum = 0;
+    Slice<int> rest = vec.as_slice();
+    while (rest.split_first().is_some()) {
+        std::pair<int &, Slice<int>> split = rest.split_first().unwrap();
+        sum += split.first;
+        rest = split.second;
+    }
+    REQUIRE(sum == 6);
+}
+
+TEST_CASE("pop moves the last element out", "[vec]") {
+    Counted::copies = 0;
+    {
+        Vec<Counted> vec;
+        for (int i = 0; i < 100; ++i)
+            vec.push(Counted(i));
+        REQUIRE(Counted::live == 100);
+
+        for (int i = 99; i >= 0; --i)
+            REQUIRE(vec.pop().unwrap().value == i);
+        REQUIRE(vec.pop().is_none());
+        REQUIRE(Counted::live == 0);
+    }
+    REQUIRE(Counted::copies == 0);
+
+    Vec<std::unique_ptr<int>> owners;
+    owners.push(std::unique_ptr<int>(new int(7)));
+    REQUIRE(*owners.pop().unwrap() == 7);
+}
+
+TEST_CASE("pop keeps the element when moving it out throws", "[vec]") {
+    {
+        Vec<MoveThrows> vec;
+        vec.push(MoveThrows(1));
+        vec.push(MoveThrows(2));
+
+        MoveThrows::fail = true;
+        REQUIRE_THROWS(vec.pop());
+        MoveThrows::fail = false;
+        REQUIRE(vec.len() == 2);
+        REQUIRE(vec.last().unwrap().value == 2);
+        REQUIRE(MoveThrows::live == 2);
+    }
+    REQUIRE(MoveThrows::live == 0);
+}
+
+TEST_CASE("Vec copies, moves and truncates", "[vec]") {
+    {
+        Vec<std::string> a = {"a", "b", "c"};
+        Vec<std::string> b = a;
+        REQUIRE(b.len() == 3);
+        REQUIRE(b[2] == "c");
+
+        Vec<std::string> c = std::move(a);
+        REQUIRE(a.is_empty());
+        REQUIRE(c.len() == 3);
+
+        c.truncate(1);
+        REQUIRE(c.len() == 1);
+        REQUIRE(c.last().unwrap() == "a");
+
+        b = c;
+        REQUIRE(b.len() == 1);
+        a = std::move(b);
+        REQUIRE(a.len() == 1);
+        REQUIRE(b.is_empty());
+
+        Vec<Counted> counted = Vec<Counted>::with_capacity(10);
+        REQUIRE(counted.capacity() == 10);
+        counted.push(Counted(1));
+        counted.clear();
+        REQUIRE(counted.capacity() == 10);
+    }
+    REQUIRE(Counted::live == 0);
+}
+
+TEST_CASE("SmallVec keeps small contents inline", "[small-vec]") {
+    SmallVec<int, 4> vec;
+    REQUIRE(vec.capacity() == 4);
+    const int *inline_data = vec.data();
+
+    for (int i = 0; i < 4; ++i)
+        vec.push(i);
+    REQUIRE(!vec.spilled());
+    REQUIRE(vec.data() == inline_data);
+
+    vec.push(4);
+    REQUIRE(vec.spilled());
+    REQUIRE(vec.data() != inline_data);
+    int sum = 0;
+    for (int v : vec)
+        sum += v;
+    REQUIRE(sum == 10);
+    REQUIRE(vec.last().unwrap() == 4);
+}
+
+TEST_CASE("SmallVec moves inline and spilled contents", "[small-vec]") {
+    {
+        SmallVec<Counted, 2> small;
+        small.push(Counted(1));
+        SmallVec<Counted, 2> moved = std::move(small);
+        REQUIRE(small.is_empty());
+        REQUIRE(moved.first().unwrap().value == 1);
+        REQUIRE(Counted::live == 1);
+
+        SmallVec<Counted, 2> big;
+        for (int i = 0; i < 5; ++i)
+            big.push(Counted(i));
+        const Counted *heap = big.data();
+        SmallVec<Counted, 2> stolen = std::move(big);
+        REQUIRE(stolen.data() == heap);
+        REQUIRE(!big.spilled());
+        REQUIRE(big.is_empty());
+
+        moved = stolen;
+        REQUIRE(moved.len() == 5);
+        REQUIRE(moved.spilled());
+        big = std::move(moved);
+        REQUIRE(big.get(4).unwrap().value == 4);
+        REQUIRE(Counted::live == 10);
+    }
+    REQUIRE(Counted::live == 0);
+}
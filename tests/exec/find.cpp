@@ -0,0 +1,63 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "exec/Find.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace rustish::exec;
+using namespace rustish::option;
+
+TEST_CASE("find_map_first returns the lowest hit", "[exec]") {
+    ThreadPool pool(4);
+    std::vector<int> values(100000, 0);
+    values[70000] = 3;
+    values[12345] = 2;
+    values[99999] = 1;
+
+    Option<size_t> hit = find_map_first(pool, 0, values.size(), [&](size_t i) {
+        return values[i] ? Option<size_t>(i) : Option<size_t>();
+    });
+    REQUIRE(hit.unwrap() == 12345);
+}
+
+TEST_CASE("find_map_any returns one of the hits", "[exec]") {
+    ThreadPool pool(4);
+    Option<size_t> hit = find_map_any(pool, 0, 1000000, [](size_t i) {
+        return i % 250000 == 1 ? Option<size_t>(i) : Option<size_t>();
+    });
+    REQUIRE(hit.is_some());
+    REQUIRE(hit.unwrap() % 250000 == 1);
+}
+
+TEST_CASE("find_map returns None without a hit", "[exec]") {
+    ThreadPool pool(2);
+    auto never = [](size_t) { return Option<int>(); };
+    REQUIRE(find_map_any(pool, 0, 50000, never).is_none());
+    REQUIRE(find_map_first(pool, 0, 50000, never).is_none());
+    REQUIRE(find_map_first(pool, 10, 10, never).is_none());
+}
+
+TEST_CASE("find_map maps the hit to its result type", "[exec]") {
+    ThreadPool pool(2);
+    Option<std::string> hit = find_map_first(pool, 5, 5000, [](size_t i) {
+        if (i % 1000 == 0)
+            return Option<std::string>("at " + std::to_string(i));
+        return Option<std::string>();
+    });
+    REQUIRE(hit.unwrap() == "at 1000");
+}
+
+TEST_CASE("an early hit cancels the remaining work", "[exec]") {
+    ThreadPool pool(4);
+    std::atomic<size_t> calls{0};
+    const size_t n = 100000000;
+    Option<size_t> hit = find_map_first(pool, 0, n, [&](size_t i) {
+        ++calls;
+        return i == 10 ? Option<size_t>(i) : Option<size_t>();
+    });
+    REQUIRE(hit.unwrap() == 10);
+    REQUIRE(calls < n / 2);
+}
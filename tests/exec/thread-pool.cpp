@@ -0,0 +1,73 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "exec/ThreadPool.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+using namespace rustish::exec;
+
+namespace {
+
+uint64_t fib(ThreadPool &pool, unsigned n) {
+    if (n < 2)
+        return n;
+    uint64_t a = 0;
+    uint64_t b = 0;
+    pool.join([&] { a = fib(pool, n - 1); }, [&] { b = fib(pool, n - 2); });
+    return a + b;
+}
+
+} // namespace
+
+TEST_CASE("join runs both sides", "[exec]") {
+    ThreadPool pool(4);
+    REQUIRE(pool.num_threads() == 4);
+    REQUIRE(fib(pool, 20) == 6765);
+}
+
+TEST_CASE("parallel_for visits every index once", "[exec]") {
+    ThreadPool pool(3);
+    std::vector<std::atomic<int>> hits(10007);
+    for (std::atomic<int> &h : hits)
+        h = 0;
+
+    pool.parallel_for(0, hits.size(), 64, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i)
+            ++hits[i];
+    });
+
+    bool once = true;
+    for (std::atomic<int> &h : hits)
+        once &= h == 1;
+    REQUIRE(once);
+}
+
+TEST_CASE("install runs on a worker", "[exec]") {
+    ThreadPool pool(2);
+    REQUIRE(pool.current_index().is_none());
+
+    bool on_worker = false;
+    pool.install([&] { on_worker = pool.current_index().is_some(); });
+    REQUIRE(on_worker);
+}
+
+TEST_CASE("spawned jobs finish before the pool is destroyed", "[exec]") {
+    std::atomic<int> ran{0};
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 1000; ++i)
+            pool.spawn([&] { ++ran; });
+        pool.install([&] {
+            for (int i = 0; i < 1000; ++i)
+                pool.spawn([&] { ++ran; });
+        });
+    }
+    REQUIRE(ran == 2000);
+}
+
+TEST_CASE("single thread pool still completes nested joins", "[exec]") {
+    ThreadPool pool(1);
+    REQUIRE(fib(pool, 15) == 610);
+}
@@ -0,0 +1,153 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "io/ColumnFile.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include <unistd.h>
+
+using namespace rustish::io;
+using namespace rustish::option;
+
+namespace {
+
+// Unique path under /tmp, removed when the test finishes.
+struct TempPath {
+    std::string path;
+
+    explicit TempPath(const char *name)
+        : path(std::string("/tmp/rustish-") + name + "-" +
+               std::to_string(::getpid())) {}
+
+    ~TempPath() { std::remove(path.c_str()); }
+};
+
+} // namespace
+
+TEST_CASE("written column reads back through the mapping", "[io]") {
+    TempPath tmp("roundtrip");
+    {
+        ColumnWriter<uint32_t> writer =
+            ColumnWriter<uint32_t>::create(tmp.path).unwrap();
+        for (uint32_t i = 0; i < 10000; ++i)
+            writer.push(i % 3 ? Option<uint32_t>(i) : Option<uint32_t>());
+        REQUIRE(writer.len() == 10000);
+        REQUIRE(writer.flush());
+    }
+
+    MappedColumn<uint32_t> column =
+        MappedColumn<uint32_t>::open(tmp.path).unwrap();
+    REQUIRE(column.len() == 10000);
+    for (uint32_t i = 0; i < 10000; ++i) {
+        Option<const uint32_t &> v = column.get(i);
+        REQUIRE(v.is_some() == (i % 3 != 0));
+        if (i % 3)
+            REQUIRE(v.unwrap() == i);
+    }
+}
+
+TEST_CASE("values are aligned in the mapping", "[io]") {
+    TempPath tmp("aligned");
+    {
+        ColumnWriter<double> writer =
+            ColumnWriter<double>::create(tmp.path).unwrap();
+        for (int i = 0; i < 5000; ++i)
+            writer.push(Option<double>(i * 0.5));
+    }
+
+    MappedColumn<double> column = MappedColumn<double>::open(tmp.path).unwrap();
+    REQUIRE(column.len() == 5000);
+    for (size_t i = 0; i < column.len(); i += 1000) {
+        const double &v = column.get(i).unwrap();
+        REQUIRE(reinterpret_cast<uintptr_t>(&v) % alignof(double) == 0);
+        REQUIRE(v == i * 0.5);
+    }
+}
+
+TEST_CASE("empty column opens with no elements", "[io]") {
+    TempPath tmp("empty");
+    ColumnWriter<uint64_t>::create(tmp.path).unwrap();
+
+    MappedColumn<uint64_t> column =
+        MappedColumn<uint64_t>::open(tmp.path).unwrap();
+    uint32_t version = ColumnHeader::current_version;
+    REQUIRE(column.is_empty());
+    REQUIRE(column.header().version == version);
+}
+
+TEST_CASE("append continues a partial block", "[io]") {
+    TempPath tmp("append");
+    {
+        ColumnWriter<int32_t> writer =
+            ColumnWriter<int32_t>::create(tmp.path).unwrap();
+        for (int32_t i = 0; i < 100; ++i)
+            writer.push(Option<int32_t>(i));
+    }
+    {
+        ColumnWriter<int32_t> writer =
+            ColumnWriter<int32_t>::append(tmp.path).unwrap();
+        REQUIRE(writer.len() == 100);
+        for (int32_t i = 100; i < 5000; ++i)
+            writer.push(i % 2 ? Option<int32_t>() : Option<int32_t>(i));
+    }
+
+    MappedColumn<int32_t> column =
+        MappedColumn<int32_t>::open(tmp.path).unwrap();
+    REQUIRE(column.len() == 5000);
+    REQUIRE(column.get(99).unwrap() == 99);
+    REQUIRE(column.get(100).unwrap() == 100);
+    REQUIRE(column.get(101).is_none());
+    REQUIRE(column.get(4096).unwrap() == 4096);
+    REQUIRE(column.get(4999).is_none());
+}
+
+TEST_CASE("readers only see flushed elements", "[io]") {
+    TempPath tmp("flush");
+    ColumnWriter<uint16_t> writer =
+        ColumnWriter<uint16_t>::create(tmp.path).unwrap();
+    writer.push(Option<uint16_t>(uint16_t(1)));
+    REQUIRE(MappedColumn<uint16_t>::open(tmp.path).unwrap().len() == 0);
+
+    REQUIRE(writer.flush());
+    REQUIRE(MappedColumn<uint16_t>::open(tmp.path).unwrap().len() == 1);
+}
+
+TEST_CASE("an open column keeps the length it was opened with", "[io]") {
+    TempPath tmp("snapshot");
+    ColumnWriter<uint64_t> writer =
+        ColumnWriter<uint64_t>::create(tmp.path).unwrap();
+    writer.push(Option<uint64_t>(uint64_t(1)));
+    REQUIRE(writer.flush());
+
+    MappedColumn<uint64_t> column =
+        MappedColumn<uint64_t>::open(tmp.path).unwrap();
+    // Grows the file and the count in the shared header well past what
+    // this mapping covers.
+    for (uint64_t i = 0; i < 10000; ++i)
+        writer.push(Option<uint64_t>(i));
+    REQUIRE(writer.flush());
+
+    REQUIRE(column.len() == 1);
+    REQUIRE(column.header().count == 1);
+    REQUIRE(column.get(0).unwrap() == 1);
+    REQUIRE(MappedColumn<uint64_t>::open(tmp.path).unwrap().len() == 10001);
+}
+
+TEST_CASE("mismatched or missing files do not open", "[io]") {
+    TempPath tmp("mismatch");
+    {
+        ColumnWriter<uint32_t> writer =
+            ColumnWriter<uint32_t>::create(tmp.path).unwrap();
+        writer.push(Option<uint32_t>(1u));
+    }
+
+    REQUIRE(MappedColumn<uint64_t>::open(tmp.path).is_none());
+    REQUIRE(ColumnWriter<uint64_t>::append(tmp.path).is_none());
+    REQUIRE(MappedColumn<uint32_t>::open(tmp.path + ".missing").is_none());
+
+    // Truncating the file below what the header claims is rejected.
+    REQUIRE(::truncate(tmp.path.c_str(), sizeof(ColumnHeader) + 1) == 0);
+    REQUIRE(MappedColumn<uint32_t>::open(tmp.path).is_none());
+}
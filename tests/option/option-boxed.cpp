@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/Boxed.hpp"
+
+#include <stdexcept>
+#include <string>
+
+using namespace rustish::option;
+using rustish::alloc::ThreadCache;
+
+namespace {
+
+struct Trace {
+    static int live;
+    static int moves;
+
+    explicit Trace(int v) : value(v) { ++live; }
+    Trace(const Trace &other) : value(other.value) { ++live; }
+    Trace(Trace &&other) : value(other.value) {
+        ++live;
+        ++moves;
+    }
+    ~Trace() { --live; }
+    Trace &operator=(const Trace &) = default;
+
+    int value;
+    char padding[1024];
+};
+
+int Trace::live = 0;
+int Trace::moves = 0;
+
+// Boxing std::string itself is rejected, since the library instantiates
+// Option<std::string> with inline storage.
+struct Text {
+    std::string str;
+
+    bool operator==(const Text &other) const { return str == other.str; }
+};
+
+// Implicit from bool so that insert(true) builds it inside the block.
+struct Throws {
+    Throws(bool fail) {
+        if (fail)
+            throw std::runtime_error("fail");
+    }
+    char padding[256];
+};
+
+} // namespace
+
+namespace rustish {
+namespace option {
+template <> struct BoxedPayload<Trace> : BoxedIn<> {};
+template <> struct BoxedPayload<Throws> : BoxedIn<> {};
+template <> struct BoxedPayload<Text> : BoxedIn<> {};
+} // namespace option
+} // namespace rustish
+
+TEST_CASE("Boxed Options are the size of a pointer", "[boxed]") {
+    REQUIRE(sizeof(Option<Trace>) == sizeof(void *));
+    REQUIRE(sizeof(Option<Text>) == sizeof(void *));
+}
+
+TEST_CASE("Boxed Options keep the Option API", "[boxed]") {
+    Option<Text> a;
+    REQUIRE(a.is_none());
+
+    a = Some(Text{"hello"});
+    REQUIRE(a.is_some());
+    REQUIRE(a.as_ref().unwrap().str == "hello");
+    a.as_mut().unwrap().str += " world";
+    REQUIRE(a == Text{"hello world"});
+
+    Option<Text> b = a;
+    REQUIRE(b == a);
+    REQUIRE(a.take().unwrap().str == "hello world");
+    REQUIRE(a.is_none());
+    REQUIRE(b.is_some());
+
+    REQUIRE(b.replace(Text{"x"}).unwrap().str == "hello world");
+    REQUIRE(a.get_or_insert(Text{"y"}).str == "y");
+    REQUIRE(b.map([](Text t) { return t.str.size(); }).unwrap() == 1);
+    REQUIRE(b.is_none());
+    REQUIRE(b.unwrap_or(Text{"z"}).str == "z");
+}
+
+TEST_CASE("Moving a boxed Option does not move the payload", "[boxed]") {
+    Trace::moves = 0;
+    {
+        Option<Trace> a(InPlace(), 7);
+        const Trace *addr = &a.as_ref().unwrap();
+
+        Option<Trace> b = std::move(a);
+        REQUIRE(a.is_none());
+        REQUIRE(&b.as_ref().unwrap() == addr);
+
+        Option<Trace> c;
+        c = std::move(b);
+        REQUIRE(&c.as_ref().unwrap() == addr);
+        REQUIRE(Trace::moves == 0);
+        REQUIRE(Trace::live == 1);
+
+        Option<Trace> d = c;
+        REQUIRE(Trace::live == 2);
+        REQUIRE(&d.as_ref().unwrap() != addr);
+        REQUIRE(d.as_ref().unwrap().value == 7);
+    }
+    REQUIRE(Trace::live == 0);
+}
+
+TEST_CASE("Boxed Options recycle their blocks", "[boxed]") {
+    const Trace *first;
+    {
+        Option<Trace> a(InPlace(), 1);
+        first = &a.as_ref().unwrap();
+    }
+    size_t cached = ThreadCache::cached();
+    Option<Trace> b(InPlace(), 2);
+    REQUIRE(&b.as_ref().unwrap() == first);
+    REQUIRE(ThreadCache::cached() == cached - 1);
+
+    // Assigning over a value reuses its block.
+    b.insert(Trace(3));
+    REQUIRE(&b.as_ref().unwrap() == first);
+    REQUIRE(b.as_ref().unwrap().value == 3);
+    b.take();
+    REQUIRE(ThreadCache::cached() == cached);
+    REQUIRE(Trace::live == 0);
+}
+
+TEST_CASE("A throwing constructor leaves a boxed Option None", "[boxed]") {
+    size_t cached = ThreadCache::cached();
+    REQUIRE_THROWS_AS(Option<Throws>(InPlace(), true), std::runtime_error);
+    REQUIRE(ThreadCache::cached() == cached + 1);
+
+    Option<Throws> a(InPlace(), false);
+    REQUIRE(a.is_some());
+    REQUIRE_THROWS_AS(a.insert(true), std::runtime_error);
+    REQUIRE(a.is_none());
+    REQUIRE(ThreadCache::cached() == cached + 1);
+}
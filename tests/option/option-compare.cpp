@@ -0,0 +1,130 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/NonZero.hpp"
+#include "option/Option.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace rustish::option;
+
+TEST_CASE("Options compare equal when both are None or hold equal values",
+          "[compare]") {
+    REQUIRE(Option<int>(1) == Option<int>(1));
+    REQUIRE(Option<int>() == Option<int>());
+    REQUIRE(Option<int>(1) != Option<int>(2));
+    REQUIRE(Option<int>(0) != Option<int>());
+    REQUIRE(Option<int>() != Option<int>(0));
+    REQUIRE(Option<int>(1) == Option<long>(1));
+
+    REQUIRE(Option<std::string>("a") == Option<std::string>("a"));
+    REQUIRE(Option<std::string>("a") != Option<std::string>("b"));
+    REQUIRE(Option<std::string>() != Option<std::string>(""));
+    REQUIRE(Option<std::string>() == Option<std::string>());
+}
+
+TEST_CASE("None orders before every Some", "[compare]") {
+    REQUIRE(Option<int>() < Option<int>(-100));
+    REQUIRE(!(Option<int>(-100) < Option<int>()));
+    REQUIRE(!(Option<int>() < Option<int>()));
+    REQUIRE(Option<int>(1) < Option<int>(2));
+    REQUIRE(Option<int>(2) > Option<int>(1));
+    REQUIRE(Option<int>(2) >= Option<int>(2));
+    REQUIRE(Option<int>() <= Option<int>());
+    REQUIRE(Option<std::string>() < Option<std::string>(""));
+    REQUIRE(Option<std::string>("a") < Option<std::string>("b"));
+}
+
+TEST_CASE("Options compare against None", "[compare]") {
+    Option<int> some = Some(1);
+    Option<int> none;
+    REQUIRE(none == None());
+    REQUIRE(None() == none);
+    REQUIRE(some != None());
+    REQUIRE(None() < some);
+    REQUIRE(!(none < None()));
+    REQUIRE(some > None());
+    REQUIRE(none <= None());
+    REQUIRE(None() >= none);
+}
+
+TEST_CASE("Options compare against plain values as Some", "[compare]") {
+    Option<int> some = Some(3);
+    Option<int> none;
+    REQUIRE(some == 3);
+    REQUIRE(3 == some);
+    REQUIRE(some != 4);
+    REQUIRE(none != 0);
+    REQUIRE(none < 0);
+    REQUIRE(0 > none);
+    REQUIRE(some < 4);
+    REQUIRE(2 < some);
+    REQUIRE(some >= 3);
+    REQUIRE(3 <= some);
+
+    Option<std::string> name = Some(std::string("abc"));
+    REQUIRE(name == "abc");
+    REQUIRE(name < "abd");
+}
+
+TEST_CASE("Options of references and niche types compare by value",
+          "[compare]") {
+    int a = 1, b = 1;
+    REQUIRE(Option<const int &>(a) == Option<const int &>(b));
+    REQUIRE(Option<const int &>() < Option<const int &>(a));
+    REQUIRE(Option<int &>(a) == 1);
+
+    REQUIRE(Option<NonZeroU32>(NonZeroU32(2)) ==
+            Option<NonZeroU32>(NonZeroU32(2)));
+    REQUIRE(Option<NonZeroU32>() < Option<NonZeroU32>(NonZeroU32(1)));
+    REQUIRE(Option<bool>(false) != Option<bool>());
+    REQUIRE(Option<bool>(false) < Option<bool>(true));
+}
+
+TEST_CASE("A moved-from Option compares as None", "[compare]") {
+    Option<int> a = Some(5);
+    Option<int> b = std::move(a);
+    REQUIRE(a == Option<int>());
+    REQUIRE(a < b);
+
+    Option<int> c = Some(7);
+    c.take();
+    REQUIRE(c == None());
+    REQUIRE(std::hash<Option<int>>()(c) == std::hash<Option<int>>()(a));
+}
+
+TEST_CASE("Options sort with std::sort", "[compare]") {
+    std::vector<Option<int>> values = {Some(3), Option<int>(), Some(-1),
+                                       Some(2), Option<int>()};
+    std::sort(values.begin(), values.end());
+    std::vector<Option<int>> expected = {Option<int>(), Option<int>(),
+                                         Some(-1), Some(2), Some(3)};
+    REQUIRE(values == expected);
+}
+
+TEST_CASE("std::hash distinguishes None from Some", "[compare]") {
+    std::hash<Option<int>> hash;
+    REQUIRE(hash(Option<int>()) == hash(Option<int>()));
+    REQUIRE(hash(Option<int>(0)) != hash(Option<int>()));
+    REQUIRE(hash(Option<int>(5)) == hash(Option<int>(5)));
+
+    std::unordered_set<Option<std::string>> set;
+    set.insert(Option<std::string>("a"));
+    set.insert(Option<std::string>());
+    set.insert(Option<std::string>("a"));
+    REQUIRE(set.size() == 2);
+    REQUIRE(set.count(Option<std::string>()) == 1);
+}
+
+#if RUSTISH_HAS_THREE_WAY
+TEST_CASE("Options support three-way comparison", "[compare]") {
+    REQUIRE(std::is_lt(Option<int>() <=> Option<int>(1)));
+    REQUIRE(std::is_gt(Option<int>(2) <=> Option<int>(1)));
+    REQUIRE(std::is_eq(Option<int>(1) <=> 1));
+    REQUIRE(std::is_eq(Option<int>() <=> None()));
+    REQUIRE(std::is_lt(None() <=> Option<int>(1)));
+}
+#endif
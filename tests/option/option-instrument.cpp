@@ -0,0 +1,114 @@
+// Instrumentation changes Option's member signatures, so this file is built
+// as its own test executable.
+#define RUSTISH_OPTION_INSTRUMENT
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/Option.hpp"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace rustish::option;
+
+namespace {
+
+// Counters recorded for this file at line, or None.
+Option<instrument::SiteStats> site_at(unsigned line) {
+    for (instrument::SiteStats &s : instrument::snapshot())
+        if (s.line == line &&
+            s.file.find("option-instrument.cpp") != std::string::npos)
+            return Option<instrument::SiteStats>(s);
+    return {};
+}
+
+} // namespace
+
+TEST_CASE("unwrap_or counts hits and misses per call site", "[instrument]") {
+    instrument::reset();
+    unsigned line = 0;
+    for (int i = 0; i < 10; ++i) {
+        Option<int> opt = i % 4 ? Option<int>(i) : Option<int>();
+        line = __LINE__ + 1;
+        opt.unwrap_or(0);
+    }
+
+    instrument::SiteStats s = site_at(line).unwrap();
+    REQUIRE(s.method == "unwrap_or");
+    REQUIRE(s.some == 7);
+    REQUIRE(s.none == 3);
+}
+
+TEST_CASE("each instrumented method is recorded", "[instrument]") {
+    instrument::reset();
+    Option<int> some = 1;
+    Option<int> none;
+
+    unsigned first = __LINE__ + 1;
+    some.unwrap_or_else([] { return 0; });
+    none.or_else([] { return Option<int>(2); });
+    none.get_or_insert_with([] { return 3; });
+
+    REQUIRE(site_at(first).unwrap().method == "unwrap_or_else");
+    REQUIRE(site_at(first).unwrap().some == 1);
+    REQUIRE(site_at(first + 1).unwrap().method == "or_else");
+    REQUIRE(site_at(first + 1).unwrap().none == 1);
+    REQUIRE(site_at(first + 2).unwrap().method == "get_or_insert_with");
+    REQUIRE(site_at(first + 2).unwrap().none == 1);
+}
+
+TEST_CASE("likely views record at the caller's site", "[instrument]") {
+    instrument::reset();
+    Option<int> some = 1;
+    Option<int> none;
+
+    unsigned first = __LINE__ + 1;
+    some.likely_some().unwrap_or(0);
+    none.likely_some().unwrap_or_else([] { return 0; });
+    none.likely_none().or_else([] { return Option<int>(2); });
+    none.likely_none().get_or_insert_with([] { return 3; });
+
+    REQUIRE(site_at(first).unwrap().method == "unwrap_or");
+    REQUIRE(site_at(first).unwrap().some == 1);
+    REQUIRE(site_at(first + 1).unwrap().method == "unwrap_or_else");
+    REQUIRE(site_at(first + 1).unwrap().none == 1);
+    REQUIRE(site_at(first + 2).unwrap().method == "or_else");
+    REQUIRE(site_at(first + 2).unwrap().none == 1);
+    REQUIRE(site_at(first + 3).unwrap().method == "get_or_insert_with");
+    REQUIRE(site_at(first + 3).unwrap().none == 1);
+}
+
+TEST_CASE("counts from other threads are merged", "[instrument]") {
+    instrument::reset();
+    unsigned line = __LINE__ + 4;
+    auto work = [] {
+        for (int i = 0; i < 1000; ++i) {
+            Option<int> none;
+            none.unwrap_or(1);
+        }
+    };
+    std::thread a(work);
+    std::thread b(work);
+    a.join();
+    b.join();
+
+    instrument::SiteStats s = site_at(line).unwrap();
+    REQUIRE(s.none == 2000);
+    REQUIRE(s.some == 0);
+}
+
+TEST_CASE("dump lists sites with the most misses first", "[instrument]") {
+    instrument::reset();
+    Option<int> none;
+    for (int i = 0; i < 5; ++i)
+        none.unwrap_or(0);
+    Option<int> some = 1;
+    some.unwrap_or(0);
+
+    std::ostringstream out;
+    instrument::dump(out);
+    std::string text = out.str();
+    REQUIRE(text.find("unwrap_or some=0 none=5") != std::string::npos);
+    REQUIRE(text.find("some=0 none=5") < text.find("some=1 none=0"));
+}
@@ -0,0 +1,133 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/Interop.hpp"
+
+#include <string>
+
+using namespace rustish::option;
+
+namespace {
+struct Counted {
+    static int copies;
+    static int moves;
+
+    static void reset() { copies = moves = 0; }
+
+    explicit Counted(int v) : value(v) {}
+    Counted(const Counted &other) : value(other.value) { ++copies; }
+    Counted(Counted &&other) : value(other.value) { ++moves; }
+
+    int value;
+};
+
+int Counted::copies = 0;
+int Counted::moves = 0;
+} // namespace
+
+TEST_CASE("from_ptr borrows the pointee", "[interop]") {
+    int value = 3;
+    Option<int &> some = from_ptr(&value);
+    REQUIRE(&some.unwrap() == &value);
+
+    int *null = nullptr;
+    REQUIRE(from_ptr(null).is_none());
+
+    const int *cptr = &value;
+    Option<const int &> csome = from_ptr(cptr);
+    REQUIRE(&csome.unwrap() == &value);
+}
+
+TEST_CASE("as_ptr points at the payload without taking it", "[interop]") {
+    Counted::reset();
+    Option<Counted> some(InPlace(), 1);
+    Counted *ptr = as_ptr(some);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(ptr->value == 1);
+    REQUIRE(some.is_some());
+
+    const Option<Counted> &cref = some;
+    REQUIRE(as_ptr(cref) == ptr);
+
+    Option<Counted> none;
+    REQUIRE(as_ptr(none) == nullptr);
+    REQUIRE(Counted::copies == 0);
+    REQUIRE(Counted::moves == 0);
+
+    int value = 5;
+    Option<int &> borrowed(value);
+    REQUIRE(as_ptr(borrowed) == &value);
+    REQUIRE(borrowed.is_some());
+    REQUIRE(as_ptr(Option<int &>()) == nullptr);
+}
+
+#if RUSTISH_HAS_OPTIONAL
+TEST_CASE("from_optional borrows lvalues", "[interop]") {
+    Counted::reset();
+    std::optional<Counted> opt(std::in_place, 2);
+    const std::optional<Counted> &cref = opt;
+
+    Option<const Counted &> borrowed = from_optional(cref);
+    REQUIRE(&borrowed.unwrap() == &*opt);
+
+    Option<Counted &> mutable_borrow = from_optional(opt);
+    mutable_borrow.unwrap().value = 3;
+    REQUIRE(opt->value == 3);
+
+    std::optional<Counted> empty;
+    REQUIRE(from_optional(empty).is_none());
+    REQUIRE(Counted::copies == 0);
+    REQUIRE(Counted::moves == 0);
+}
+
+TEST_CASE("from_optional moves rvalues once", "[interop]") {
+    Counted::reset();
+    std::optional<Counted> opt(std::in_place, 2);
+    Option<Counted> moved = from_optional(std::move(opt));
+    REQUIRE(Counted::copies == 0);
+    REQUIRE(Counted::moves == 1);
+    REQUIRE(moved.is_some());
+    REQUIRE(from_optional(std::optional<Counted>()).is_none());
+}
+
+TEST_CASE("into_optional moves the payload once", "[interop]") {
+    Counted::reset();
+    Option<Counted> opt(InPlace(), 4);
+    std::optional<Counted> moved = into_optional(std::move(opt));
+    REQUIRE(Counted::copies == 0);
+    REQUIRE(Counted::moves == 1);
+    REQUIRE(moved->value == 4);
+    REQUIRE(opt.is_none());
+
+    REQUIRE(!into_optional(Option<std::string>()).has_value());
+    REQUIRE(*into_optional(Option<std::string>("abc")) == "abc");
+}
+#endif
+
+#if RUSTISH_HAS_EXPECTED
+TEST_CASE("from_expected keeps the value and drops the error",
+          "[interop]") {
+    Counted::reset();
+    std::expected<Counted, std::string> ok(std::in_place, 6);
+    REQUIRE(&from_expected(ok).unwrap() == &*ok);
+    REQUIRE(from_expected(std::move(ok)).unwrap().value == 6);
+    REQUIRE(Counted::copies == 0);
+
+    std::expected<Counted, std::string> err(std::unexpect, "bad");
+    REQUIRE(from_expected(err).is_none());
+}
+
+TEST_CASE("into_expected moves the payload or uses the error",
+          "[interop]") {
+    Counted::reset();
+    Option<Counted> opt(InPlace(), 7);
+    std::expected<Counted, std::string> ok =
+        into_expected(std::move(opt), std::string("missing"));
+    REQUIRE(ok->value == 7);
+    REQUIRE(Counted::copies == 0);
+    REQUIRE(Counted::moves == 1);
+
+    std::expected<Counted, std::string> err =
+        into_expected(Option<Counted>(), std::string("missing"));
+    REQUIRE(err.error() == "missing");
+}
+#endif
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/Option.hpp"
+
+#include <string>
+
+using namespace rustish::option;
+
+TEST_CASE("likely views report the same state", "[likely]") {
+    Option<int> some = 1;
+    Option<int> none;
+    REQUIRE(some.likely_some().is_some());
+    REQUIRE(some.likely_none().is_some());
+    REQUIRE(none.likely_some().is_none());
+    REQUIRE(none.likely_none().is_none());
+}
+
+TEST_CASE("likely unwrap_or moves the value out", "[likely]") {
+    Option<std::string> some = std::string("hit");
+    REQUIRE(some.likely_some().unwrap_or(std::string("miss")) == "hit");
+    REQUIRE(some.is_none());
+
+    Option<std::string> none;
+    REQUIRE(none.likely_none().unwrap_or(std::string("miss")) == "miss");
+    REQUIRE(none.likely_none().unwrap_or_else([] {
+        return std::string("else");
+    }) == "else");
+    REQUIRE(none.likely_some().unwrap_or_default().empty());
+}
+
+TEST_CASE("likely map and and_then", "[likely]") {
+    Option<int> some = 2;
+    REQUIRE(some.likely_some().map([](int x) { return x * 3; }).unwrap() ==
+            6);
+
+    Option<int> again = 2;
+    REQUIRE(again.likely_some()
+                .and_then([](int x) { return Option<int>(x + 1); })
+                .unwrap() == 3);
+
+    Option<int> none;
+    REQUIRE(none.likely_none().map([](int x) { return x; }).is_none());
+    REQUIRE(none.likely_none().map_or(7, [](int x) { return x; }).unwrap() ==
+            7);
+}
+
+TEST_CASE("likely or_else and get_or_insert_with", "[likely]") {
+    Option<int> none;
+    REQUIRE(none.likely_none().or_else([] { return Option<int>(4); })
+                .unwrap() == 4);
+
+    int &value = none.likely_none().get_or_insert_with([] { return 5; });
+    value = 6;
+    REQUIRE(none.as_ref().unwrap() == 6);
+    REQUIRE(none.likely_some().get_or_insert_with([] { return 0; }) == 6);
+}
+
+TEST_CASE("likely views work on temporaries", "[likely]") {
+    int x = 9;
+    const int &fallback = 0;
+    REQUIRE(Option<int &>(x).as_ref().likely_some().unwrap_or(fallback) == 9);
+}
@@ -0,0 +1,129 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/NanNiche.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using namespace rustish::option;
+
+namespace {
+
+template <typename T> NanNiche<T> from_bits(typename NanBits<T>::bits_t bits) {
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return NanNiche<T>(value);
+}
+
+} // namespace
+
+TEST_CASE("Option<NanNiche<T>> is the size of T", "[nan-niche]") {
+    REQUIRE(sizeof(Option<NanNiche<double>>) == sizeof(double));
+    REQUIRE(sizeof(Option<NanNiche<float>>) == sizeof(float));
+    REQUIRE(sizeof(Option<double>) == 2 * sizeof(double));
+}
+
+TEST_CASE("Option<NanNiche<T>> holds ordinary values", "[nan-niche]") {
+    Option<NanNiche<double>> a = NanNiche<double>(1.5);
+    REQUIRE(a.is_some());
+    REQUIRE(a.unwrap() == 1.5);
+
+    Option<NanNiche<float>> b = NanNiche<float>(-0.0f);
+    REQUIRE(b.is_some());
+    REQUIRE(std::signbit(b.unwrap().get()));
+
+    Option<NanNiche<double>> c;
+    REQUIRE(c.is_none());
+    Option<NanNiche<double>> d = None();
+    REQUIRE(d.is_none());
+}
+
+TEST_CASE("real NaNs are Some", "[nan-niche]") {
+    SECTION("quiet NaN") {
+        Option<NanNiche<double>> a =
+            NanNiche<double>(std::numeric_limits<double>::quiet_NaN());
+        REQUIRE(a.is_some());
+        REQUIRE(std::isnan(a.unwrap().get()));
+    }
+
+    SECTION("signalling NaN") {
+        Option<NanNiche<float>> a =
+            NanNiche<float>(std::numeric_limits<float>::signaling_NaN());
+        REQUIRE(a.is_some());
+        REQUIRE(std::isnan(a.unwrap().get()));
+    }
+
+    SECTION("a NaN carrying the reserved payload is quieted") {
+        uint64_t none = NanBits<double>::none;
+        NanNiche<double> v = from_bits<double>(none);
+        REQUIRE(std::isnan(v.get()));
+        REQUIRE(v.bits() != none);
+        Option<NanNiche<double>> a = v;
+        REQUIRE(a.is_some());
+
+        NanNiche<float> f = from_bits<float>(NanBits<float>::none);
+        Option<NanNiche<float>> b = f;
+        REQUIRE(b.is_some());
+    }
+}
+
+TEST_CASE("NaN propagates through arithmetic without becoming None",
+          "[nan-niche]") {
+    volatile double zero = 0.0;
+    volatile double inf = std::numeric_limits<double>::infinity();
+
+    SECTION("0/0 and inf-inf") {
+        Option<NanNiche<double>> a = NanNiche<double>(zero / zero);
+        Option<NanNiche<double>> b = NanNiche<double>(inf - inf);
+        REQUIRE(a.is_some());
+        REQUIRE(b.is_some());
+    }
+
+    SECTION("map over a NaN") {
+        Option<NanNiche<double>> a =
+            NanNiche<double>(std::numeric_limits<double>::quiet_NaN());
+        Option<NanNiche<double>> b = a.map(
+            [](NanNiche<double> &&v) { return NanNiche<double>(v * 2 + 1); });
+        REQUIRE(b.is_some());
+        REQUIRE(std::isnan(b.unwrap().get()));
+    }
+
+    SECTION("arithmetic on the None pattern itself stays a NaN value") {
+        double none;
+        uint64_t bits = NanBits<double>::none;
+        std::memcpy(&none, &bits, sizeof(none));
+        Option<NanNiche<double>> a = NanNiche<double>(none + 1.0);
+        REQUIRE(a.is_some());
+        REQUIRE(std::isnan(a.unwrap().get()));
+    }
+
+    SECTION("None propagates through map") {
+        Option<NanNiche<double>> a;
+        Option<NanNiche<double>> b = a.map(
+            [](NanNiche<double> &&v) { return NanNiche<double>(v * 2); });
+        REQUIRE(b.is_none());
+        REQUIRE(a.map([](NanNiche<double> &&v) { return v + 1.0; })
+                    .is_none());
+    }
+
+    SECTION("Some propagates through and_then") {
+        Option<NanNiche<double>> a = NanNiche<double>(2.0);
+        Option<NanNiche<double>> b =
+            a.and_then([](NanNiche<double> &&v) -> Option<NanNiche<double>> {
+                return NanNiche<double>(v * v);
+            });
+        REQUIRE(b.unwrap() == 4.0);
+    }
+}
+
+TEST_CASE("Option<NanNiche<T>> take and replace", "[nan-niche]") {
+    Option<NanNiche<double>> a = NanNiche<double>(3.0);
+    Option<NanNiche<double>> b = a.take();
+    REQUIRE(a.is_none());
+    REQUIRE(b.unwrap() == 3.0);
+
+    Option<NanNiche<double>> c = a.replace(NanNiche<double>(4.0));
+    REQUIRE(c.is_none());
+    REQUIRE(a.unwrap_or(NanNiche<double>(0.0)) == 4.0);
+}
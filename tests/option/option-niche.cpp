@@ -0,0 +1,102 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/Option.hpp"
+
+#include <cstdint>
+
+using namespace rustish::option;
+
+namespace {
+
+enum class Color : uint8_t { Red, Green, Blue, Unused = 0xFF };
+enum class Mode : uint8_t { Off, On, Auto };
+enum class Wide : int { A = 1, B = 2 };
+
+} // namespace
+
+namespace rustish {
+namespace option {
+template <> struct EnumNiche<Color> : EnumSpare<Color, Color::Unused> {};
+template <> struct EnumNiche<Mode> : EnumCount<Mode, 3> {};
+template <> struct EnumNiche<Wide> : EnumSpare<Wide, Wide(0)> {};
+} // namespace option
+} // namespace rustish
+
+TEST_CASE("Option<bool> fits in one byte", "[niche]") {
+    REQUIRE(sizeof(Option<bool>) == 1);
+}
+
+TEST_CASE("Option<bool> keeps None, true and false apart", "[niche]") {
+    Option<bool> none;
+    Option<bool> yes = Some(true);
+    Option<bool> no = Some(false);
+    REQUIRE(none.is_none());
+    REQUIRE(yes.is_some());
+    REQUIRE(no.is_some());
+    REQUIRE(yes.unwrap() == true);
+    REQUIRE(no.unwrap() == false);
+    REQUIRE(yes.is_none());
+    REQUIRE(no.is_none());
+}
+
+TEST_CASE("Option<bool> supports the combinators", "[niche]") {
+    SECTION("unwrap_or") {
+        REQUIRE(Option<bool>().unwrap_or(true) == true);
+        REQUIRE(Some(false).unwrap_or(true) == false);
+    }
+
+    SECTION("map") {
+        Option<int> a = Some(true).map([](bool &&b) { return b ? 1 : 0; });
+        REQUIRE(a.unwrap() == 1);
+    }
+
+    SECTION("as_mut writes through") {
+        Option<bool> a = Some(false);
+        a.as_mut().unwrap() = true;
+        REQUIRE(a.unwrap() == true);
+    }
+
+    SECTION("take and replace") {
+        Option<bool> a = Some(true);
+        Option<bool> b = a.take();
+        REQUIRE(a.is_none());
+        REQUIRE(b.unwrap() == true);
+        Option<bool> c = a.replace(false);
+        REQUIRE(c.is_none());
+        REQUIRE(a.unwrap() == false);
+    }
+
+    SECTION("copy") {
+        Option<bool> a = Some(true);
+        Option<bool> b = a;
+        Option<bool> c;
+        Option<bool> d = c;
+        REQUIRE(b.unwrap() == true);
+        REQUIRE(d.is_none());
+    }
+}
+
+TEST_CASE("Option of an enum with a spare value fits in the enum", "[niche]") {
+    REQUIRE(sizeof(Option<Color>) == 1);
+    REQUIRE(sizeof(Option<Mode>) == 1);
+    REQUIRE(sizeof(Option<Wide>) == sizeof(Wide));
+}
+
+TEST_CASE("Option of an enum keeps every enumerator", "[niche]") {
+    for (Color c : {Color::Red, Color::Green, Color::Blue}) {
+        Option<Color> opt = c;
+        REQUIRE(opt.is_some());
+        REQUIRE(opt.unwrap() == c);
+    }
+    for (Mode m : {Mode::Off, Mode::On, Mode::Auto}) {
+        Option<Mode> opt = m;
+        REQUIRE(opt.is_some());
+        REQUIRE(opt.unwrap() == m);
+    }
+
+    Option<Color> none;
+    REQUIRE(none.is_none());
+    Option<Mode> none_mode = None();
+    REQUIRE(none_mode.is_none());
+    REQUIRE(Option<Wide>().unwrap_or(Wide::B) == Wide::B);
+}
@@ -0,0 +1,81 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/NonZero.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+using namespace rustish::option;
+
+TEST_CASE("Option of NonZero/NonNegative is the width of the value",
+          "[non-zero]") {
+    REQUIRE(sizeof(Option<NonZeroU64>) == sizeof(uint64_t));
+    REQUIRE(sizeof(Option<NonZeroU8>) == sizeof(uint8_t));
+    REQUIRE(sizeof(Option<NonNegative<int>>) == sizeof(int));
+    REQUIRE(sizeof(Option<uint64_t>) == 2 * sizeof(uint64_t));
+}
+
+TEST_CASE("NonZero::new_ checks for zero", "[non-zero]") {
+    REQUIRE(NonZeroU64::new_(0).is_none());
+    REQUIRE(NonZeroU64::new_(1).unwrap() == 1u);
+    REQUIRE(NonZeroI32::new_(-5).unwrap() == -5);
+    REQUIRE(NonZeroU64::new_(UINT64_MAX).unwrap() == UINT64_MAX);
+}
+
+TEST_CASE("NonZero is only assigned through its checked constructor",
+          "[non-zero]") {
+    static_assert(!std::is_assignable<Option<NonZeroU32> &, uint32_t>::value,
+                  "a raw integer must go through NonZero::new_");
+    Option<NonZeroU32> nz;
+    nz = NonZeroU32(7u);
+    REQUIRE(nz.unwrap() == 7u);
+}
+
+TEST_CASE("NonNegative::new_ checks for negative values", "[non-zero]") {
+    REQUIRE(NonNegative<int>::new_(-1).is_none());
+    REQUIRE(NonNegative<int>::new_(-100).is_none());
+    REQUIRE(NonNegative<int>::new_(0).unwrap() == 0);
+    REQUIRE(NonNegative<int64_t>::new_(INT64_MAX).unwrap() == INT64_MAX);
+}
+
+TEST_CASE("Option<NonZero<T>> keeps values and None apart", "[non-zero]") {
+    Option<NonZeroU32> none;
+    REQUIRE(none.is_none());
+
+    Option<NonZeroU32> one = NonZeroU32(1);
+    REQUIRE(one.is_some());
+
+    SECTION("map") {
+        Option<uint32_t> plus =
+            one.map([](NonZeroU32 &&v) { return v.get() + 1; });
+        REQUIRE(plus.unwrap() == 2u);
+    }
+
+    SECTION("and_then chains checked construction") {
+        Option<NonZeroU32> dec = one.and_then(
+            [](NonZeroU32 &&v) { return NonZeroU32::new_(v.get() - 1); });
+        REQUIRE(dec.is_none());
+    }
+
+    SECTION("take and insert") {
+        Option<NonZeroU32> taken = one.take();
+        REQUIRE(one.is_none());
+        REQUIRE(taken.unwrap() == 1u);
+        one.insert(NonZeroU32(9));
+        REQUIRE(one.unwrap() == 9u);
+    }
+}
+
+TEST_CASE("Option<NonNegative<T>> keeps zero distinct from None",
+          "[non-zero]") {
+    Option<NonNegative<int>> fd = NonNegative<int>(0);
+    REQUIRE(fd.is_some());
+    REQUIRE(fd.unwrap() == 0);
+    REQUIRE(fd.is_none());
+}
+
+TEST_CASE("NonZero hashes like its value", "[non-zero]") {
+    REQUIRE(std::hash<NonZeroU64>()(NonZeroU64(42)) ==
+            std::hash<uint64_t>()(42));
+}
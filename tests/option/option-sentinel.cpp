@@ -0,0 +1,71 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/Sentinel.hpp"
+
+#include <cstdint>
+#include <vector>
+
+using namespace rustish::option;
+
+using Fd = Sentinel<int, -1>;
+
+TEST_CASE("Option of a Sentinel is the width of the value", "[sentinel]") {
+    REQUIRE(sizeof(Option<Index32>) == sizeof(uint32_t));
+    REQUIRE(sizeof(Option<Index64>) == sizeof(uint64_t));
+    REQUIRE(sizeof(Option<Fd>) == sizeof(int));
+    REQUIRE(sizeof(Option<uint32_t>) == 2 * sizeof(uint32_t));
+}
+
+TEST_CASE("new_ rejects the reserved value", "[sentinel]") {
+    REQUIRE(Fd::new_(-1).is_none());
+    REQUIRE(Fd::new_(3).unwrap().get() == 3);
+    REQUIRE(Index32::new_(UINT32_MAX).is_none());
+    REQUIRE(Index32::new_(0).unwrap() == 0u);
+}
+
+TEST_CASE("Option of a Sentinel keeps values and None apart", "[sentinel]") {
+    Option<Index32> none;
+    REQUIRE(none.is_none());
+
+    Option<Index32> zero = Index32(0);
+    REQUIRE(zero.is_some());
+    REQUIRE(zero.unwrap() == 0u);
+
+    Option<Index32> max = Index32(UINT32_MAX - 1);
+    REQUIRE(max.is_some());
+    REQUIRE(max.unwrap() == UINT32_MAX - 1);
+}
+
+TEST_CASE("Option of a Sentinel supports the combinators", "[sentinel]") {
+    Option<Fd> fd = Fd(4);
+
+    SECTION("map") {
+        Option<int> doubled = fd.map([](Fd &&v) { return v.get() * 2; });
+        REQUIRE(doubled.unwrap() == 8);
+    }
+
+    SECTION("take") {
+        Option<Fd> taken = fd.take();
+        REQUIRE(fd.is_none());
+        REQUIRE(taken.unwrap() == 4);
+    }
+
+    SECTION("get_or_insert") {
+        Option<Fd> empty;
+        REQUIRE(empty.get_or_insert(Fd(7)).get() == 7);
+        REQUIRE(empty.is_some());
+    }
+}
+
+TEST_CASE("arrays of Option<Index32> are half the size", "[sentinel]") {
+    std::vector<Option<Index32>> parents(100);
+    for (uint32_t i = 0; i < 100; i += 2)
+        parents[i] = Index32(i / 2);
+
+    for (uint32_t i = 0; i < 100; ++i) {
+        if (i % 2)
+            REQUIRE(parents[i].is_none());
+        else
+            REQUIRE(parents[i].as_ref().unwrap() == i / 2);
+    }
+}
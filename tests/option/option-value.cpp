@@ -2,6 +2,10 @@
 
 #include "option/Option.hpp"
 
+#include <string>
+#include <type_traits>
+#include <vector>
+
 using namespace rustish::option;
 
 TEST_CASE("Initialize Option with None structure", "[value]") {
@@ -492,3 +496,144 @@ TEST_CASE("replace returns old option", "[value]") {
         REQUIRE(!b.is_some());
     }
 }
+
+namespace {
+struct LiveCount {
+    static int live;
+
+    LiveCount() { ++live; }
+    LiveCount(const LiveCount &) { ++live; }
+    LiveCount(LiveCount &&) { ++live; }
+    ~LiveCount() { --live; }
+};
+
+int LiveCount::live = 0;
+} // namespace
+
+TEST_CASE("moves and unwraps destroy the moved-from value", "[value]") {
+    {
+        Option<LiveCount> a = LiveCount();
+        Option<LiveCount> b = std::move(a);
+        Option<LiveCount> c = None();
+        Option<LiveCount> d = c;
+        REQUIRE(LiveCount::live == 1);
+
+        LiveCount value = b.unwrap();
+        REQUIRE(LiveCount::live == 1);
+    }
+    REQUIRE(LiveCount::live == 0);
+}
+
+namespace {
+struct FromInt {
+    static int moves;
+
+    explicit FromInt(int v) : value(v) {}
+    FromInt(const FromInt &other) : value(other.value) {}
+    FromInt(FromInt &&other) : value(other.value) { ++moves; }
+
+    int value;
+};
+
+int FromInt::moves = 0;
+
+// Whether unwrap_or(U) and insert(U) are callable on an O.
+template <typename O, typename U, typename = void>
+struct CanUnwrapOr : std::false_type {};
+
+template <typename O, typename U>
+struct CanUnwrapOr<O, U,
+                   decltype(void(std::declval<O &>().unwrap_or(
+                       std::declval<U>())))> : std::true_type {};
+
+template <typename O, typename U, typename = void>
+struct CanInsert : std::false_type {};
+
+template <typename O, typename U>
+struct CanInsert<O, U,
+                 decltype(void(std::declval<O &>().insert(std::declval<U>())))>
+    : std::true_type {};
+} // namespace
+
+TEST_CASE("Option converts from arguments of the payload type",
+          "[value]") {
+    SECTION("construction") {
+        Option<std::string> a = "abc";
+        REQUIRE(a.is_some());
+        REQUIRE(a.unwrap_unchecked() == "abc");
+    }
+
+    SECTION("assignment") {
+        Option<std::string> a;
+        a = "abc";
+        REQUIRE(a.unwrap_unchecked() == "abc");
+        a = "de";
+        REQUIRE(a.unwrap_unchecked() == "de");
+    }
+
+    SECTION("insert, get_or_insert and replace") {
+        Option<std::string> a;
+        REQUIRE(a.insert("abc") == "abc");
+        REQUIRE(a.get_or_insert("de") == "abc");
+        Option<std::string> b = a.replace("de");
+        REQUIRE(b.unwrap_unchecked() == "abc");
+        REQUIRE(a.unwrap_unchecked() == "de");
+    }
+
+    SECTION("unwrap_or") {
+        Option<std::string> a;
+        REQUIRE(a.unwrap_or("abc") == "abc");
+    }
+}
+
+TEST_CASE("converting construction builds the payload in place", "[value]") {
+    FromInt::moves = 0;
+    Option<FromInt> a(5);
+    REQUIRE(a.as_ref().unwrap_unchecked().value == 5);
+    REQUIRE(FromInt::moves == 0);
+    REQUIRE(a.insert(FromInt(6)).value == 6);
+}
+
+TEST_CASE("converting construction follows the payload's explicitness",
+          "[value]") {
+    static_assert(std::is_convertible<const char *, Option<std::string>>::value,
+                  "implicit payload conversion is implicit for Option");
+    static_assert(!std::is_convertible<int, Option<FromInt>>::value,
+                  "explicit payload conversion is explicit for Option");
+    static_assert(std::is_constructible<Option<FromInt>, int>::value,
+                  "explicit payload conversion is available");
+    static_assert(
+        !std::is_constructible<Option<const std::string &>, const char *>::value,
+        "reference Options never bind to a converted temporary");
+    static_assert(!std::is_constructible<Option<int>, std::string>::value,
+                  "unrelated types are rejected");
+}
+
+TEST_CASE("assignment and fallbacks take only implicit conversions",
+          "[value]") {
+    static_assert(
+        std::is_assignable<Option<std::string> &, const char *>::value,
+        "implicit payload conversion assigns");
+    static_assert(!std::is_assignable<Option<FromInt> &, int>::value,
+                  "explicit payload conversion does not assign");
+    static_assert(!std::is_assignable<Option<std::vector<int>> &, int>::value,
+                  "a size is not a vector");
+    static_assert(CanUnwrapOr<Option<std::string>, const char *>::value,
+                  "implicit payload conversion is a fallback");
+    static_assert(!CanUnwrapOr<Option<FromInt>, int>::value,
+                  "explicit payload conversion is not a fallback");
+    static_assert(!CanUnwrapOr<Option<std::vector<int>>, int>::value,
+                  "a size is not a vector");
+    static_assert(CanInsert<Option<std::string>, const char *>::value,
+                  "implicit payload conversion inserts");
+    static_assert(!CanInsert<Option<FromInt>, int>::value,
+                  "explicit payload conversion does not insert");
+    static_assert(!CanInsert<Option<std::vector<int>>, int>::value,
+                  "a size is not a vector");
+
+    // Explicit conversions stay available where they are spelled out.
+    Option<std::vector<int>> v(InPlace(), 3);
+    REQUIRE(v.as_ref().unwrap().size() == 3);
+    v = std::vector<int>(4);
+    REQUIRE(v.as_ref().unwrap().size() == 4);
+}
@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "option/NonZero.hpp"
+#include "option/Zip.hpp"
+
+#include <string>
+#include <tuple>
+
+using namespace rustish::option;
+
+namespace {
+struct MoveCount {
+    static int moves;
+    static int copies;
+
+    explicit MoveCount(int v) : value(v) {}
+    MoveCount(const MoveCount &other) : value(other.value) { ++copies; }
+    MoveCount(MoveCount &&other) : value(other.value) { ++moves; }
+
+    int value;
+};
+
+int MoveCount::moves = 0;
+int MoveCount::copies = 0;
+} // namespace
+
+TEST_CASE("all_some checks every Option", "[zip]") {
+    Option<int> a = Some(1);
+    Option<std::string> b = Some(std::string("b"));
+    Option<NonZeroU32> c = Option<NonZeroU32>(NonZeroU32(3));
+    Option<NonZeroU32> none;
+
+    REQUIRE(all_some(a, b, c));
+    REQUIRE(!all_some(a, b, c, none));
+    REQUIRE(!all_some(none));
+    REQUIRE(all_some(a));
+    REQUIRE(a.is_some());
+}
+
+TEST_CASE("zip moves every payload into a tuple", "[zip]") {
+    Option<int> a = Some(1);
+    Option<std::string> b = Some(std::string("b"));
+    Option<NonZeroU32> c = Option<NonZeroU32>(NonZeroU32(3));
+
+    Option<std::tuple<int, std::string, NonZeroU32>> zipped = zip(a, b, c);
+    REQUIRE(zipped.is_some());
+    std::tuple<int, std::string, NonZeroU32> values = zipped.unwrap();
+    REQUIRE(std::get<0>(values) == 1);
+    REQUIRE(std::get<1>(values) == "b");
+    REQUIRE(std::get<2>(values).get() == 3u);
+    REQUIRE(a.is_none());
+    REQUIRE(b.is_none());
+    REQUIRE(c.is_none());
+}
+
+TEST_CASE("zip leaves the Options alone when one is None", "[zip]") {
+    Option<int> a = Some(1);
+    Option<std::string> b;
+    Option<int> c = Some(3);
+
+    REQUIRE(zip(a, b, c).is_none());
+    REQUIRE(a.is_some());
+    REQUIRE(c.is_some());
+}
+
+TEST_CASE("zip accepts temporaries and references", "[zip]") {
+    int value = 4;
+    Option<std::tuple<int &, int>> zipped =
+        zip(Option<int &>(value), Option<int>(5));
+    std::tuple<int &, int> values = zipped.unwrap();
+    REQUIRE(&std::get<0>(values) == &value);
+    REQUIRE(std::get<1>(values) == 5);
+}
+
+TEST_CASE("with_all calls the function only when all are Some", "[zip]") {
+    Option<int> a = Some(1);
+    Option<int> b = Some(2);
+    Option<int> none;
+
+    SECTION("returns Some of the result") {
+        Option<int> sum = with_all(a, b, [](int x, int y) { return x + y; });
+        REQUIRE(sum.unwrap() == 3);
+        REQUIRE(a.is_none());
+        REQUIRE(b.is_none());
+    }
+
+    SECTION("returns None without calling the function") {
+        bool called = false;
+        Option<int> sum = with_all(a, none, [&](int x, int y) {
+            called = true;
+            return x + y;
+        });
+        REQUIRE(sum.is_none());
+        REQUIRE(!called);
+        REQUIRE(a.is_some());
+    }
+
+    SECTION("void functions report whether they ran") {
+        int seen = 0;
+        REQUIRE(with_all(a, b, [&](int x, int y) { seen = x + y; }));
+        REQUIRE(seen == 3);
+        REQUIRE(!with_all(none, [&](int x) { seen = x; }));
+        REQUIRE(seen == 3);
+    }
+}
+
+TEST_CASE("with_all moves each payload out once", "[zip]") {
+    MoveCount::moves = 0;
+    MoveCount::copies = 0;
+    Option<MoveCount> a(InPlace(), 1);
+    Option<MoveCount> b(InPlace(), 2);
+    int sum = with_all(a, b, [](MoveCount &&x, MoveCount &&y) {
+                  return x.value + y.value;
+              }).unwrap();
+    REQUIRE(sum == 3);
+    REQUIRE(MoveCount::moves == 2);
+    REQUIRE(MoveCount::copies == 0);
+}
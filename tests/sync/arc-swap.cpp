@@ -0,0 +1,156 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "sync/ArcSwap.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rustish::boxed;
+using namespace rustish::option;
+using namespace rustish::sync;
+
+namespace {
+
+// Readers check that they never see a half-built or freed snapshot: a
+// destroyed Config has its fields cleared, breaking the invariant.
+struct Config {
+    static std::atomic<int> live;
+
+    explicit Config(uint64_t v) : version(v), check(~v) { ++live; }
+    ~Config() {
+        version = 0;
+        check = 0;
+        --live;
+    }
+
+    bool valid() const { return check == ~version; }
+
+    uint64_t version;
+    uint64_t check;
+};
+
+std::atomic<int> Config::live{0};
+
+// Runs enough collections to free everything retired while no thread is
+// pinned.
+void reclaim() {
+    for (int i = 0; i < 3; ++i)
+        Epoch::collect();
+}
+
+} // namespace
+
+TEST_CASE("ArcSwapOption loads what was stored", "[sync]") {
+    ArcSwapOption<std::string> swap;
+    REQUIRE(swap.load().is_none());
+    REQUIRE(swap.load_full().is_none());
+
+    swap.store(Arc<std::string>::new_("a"));
+    REQUIRE(swap.load().as_ref().unwrap() == "a");
+
+    Option<Arc<std::string>> full = swap.load_full();
+    REQUIRE(*full.as_ref().unwrap() == "a");
+    REQUIRE(full.as_ref().unwrap().strong_count() == 2);
+
+    Option<Arc<std::string>> old = swap.swap(Arc<std::string>::new_("b"));
+    REQUIRE(*old.unwrap() == "a");
+    REQUIRE(swap.load().as_ref().unwrap() == "b");
+
+    swap.store(None());
+    REQUIRE(swap.load().is_none());
+    REQUIRE(swap.swap(None()).is_none());
+}
+
+TEST_CASE("ArcSwapOption defers releasing replaced values", "[sync]") {
+    reclaim();
+    {
+        ArcSwapOption<Config> swap(Arc<Config>::new_(1));
+        {
+            ArcSwapOption<Config>::Snapshot snap = swap.load();
+            swap.store(Arc<Config>::new_(2));
+            reclaim();
+            // The snapshot keeps this thread pinned, so version 1 stays.
+            REQUIRE(Config::live == 2);
+            REQUIRE(snap.as_ref().unwrap().version == 1);
+            REQUIRE(Epoch::pending() == 1);
+        }
+        reclaim();
+        REQUIRE(Config::live == 1);
+        REQUIRE(Epoch::pending() == 0);
+
+        // A reference from load_full() outlives the swap's own.
+        Option<Arc<Config>> kept = swap.load_full();
+        swap.store(None());
+        reclaim();
+        REQUIRE(Config::live == 1);
+        REQUIRE(kept.unwrap()->version == 2);
+    }
+    REQUIRE(Config::live == 0);
+}
+
+TEST_CASE("ArcSwapOption frees replaced values promptly without readers",
+          "[sync]") {
+    reclaim();
+    {
+        ArcSwapOption<Config> swap(Arc<Config>::new_(0));
+        for (uint64_t i = 1; i <= 300; ++i) {
+            swap.store(Arc<Config>::new_(i));
+            // The current value and at most the one it replaced.
+            REQUIRE(Config::live <= 2);
+        }
+
+        swap.store(Arc<Config>::new_(301));
+        REQUIRE(Epoch::pending() <= 1);
+        reclaim();
+        REQUIRE(Epoch::pending() == 0);
+        REQUIRE(Config::live == 1);
+    }
+    REQUIRE(Config::live == 0);
+}
+
+TEST_CASE("ArcSwapOption readers never see freed values", "[sync]") {
+    const int readers = 4;
+    const uint64_t versions = 20000;
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> invalid{0};
+    std::atomic<uint64_t> backwards{0};
+    {
+        ArcSwapOption<Config> swap(Arc<Config>::new_(1));
+
+        std::vector<std::thread> threads;
+        for (int r = 0; r < readers; ++r) {
+            threads.emplace_back([&] {
+                uint64_t last = 0;
+                while (!done.load(std::memory_order_acquire)) {
+                    ArcSwapOption<Config>::Snapshot snap = swap.load();
+                    const Config &config = snap.as_ref().unwrap();
+                    if (!config.valid())
+                        invalid.fetch_add(1);
+                    if (config.version < last)
+                        backwards.fetch_add(1);
+                    last = config.version;
+                }
+            });
+        }
+
+        std::thread writer([&] {
+            for (uint64_t v = 2; v <= versions; ++v)
+                swap.store(Arc<Config>::new_(v));
+            done.store(true, std::memory_order_release);
+        });
+
+        writer.join();
+        for (std::thread &t : threads)
+            t.join();
+
+        REQUIRE(swap.load().as_ref().unwrap().version == versions);
+        reclaim();
+        REQUIRE(Config::live == 1);
+    }
+    REQUIRE(invalid == 0);
+    REQUIRE(backwards == 0);
+    REQUIRE(Config::live == 0);
+}
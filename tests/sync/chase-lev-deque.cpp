@@ -0,0 +1,84 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "sync/ChaseLevDeque.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace rustish::option;
+using namespace rustish::sync;
+
+TEST_CASE("owner pops newest, thieves steal oldest", "[sync]") {
+    ChaseLevDeque<int> d(4);
+    REQUIRE(d.pop().is_none());
+    REQUIRE(d.steal().is_none());
+
+    for (int i = 0; i < 4; ++i)
+        d.push(i);
+    REQUIRE(d.len() == 4);
+    REQUIRE(d.pop().unwrap() == 3);
+    REQUIRE(d.steal().unwrap() == 0);
+    REQUIRE(d.steal().unwrap() == 1);
+    REQUIRE(d.pop().unwrap() == 2);
+    REQUIRE(d.is_empty());
+    REQUIRE(d.pop().is_none());
+}
+
+TEST_CASE("ChaseLevDeque grows past its initial capacity", "[sync]") {
+    ChaseLevDeque<uint32_t> d(2);
+    for (uint32_t i = 0; i < 1000; ++i)
+        d.push(i);
+    REQUIRE(d.len() == 1000);
+    for (uint32_t i = 0; i < 500; ++i)
+        REQUIRE(d.steal().unwrap() == i);
+    for (uint32_t i = 999; i >= 500; --i)
+        REQUIRE(d.pop().unwrap() == i);
+    REQUIRE(d.is_empty());
+}
+
+TEST_CASE("each value is taken exactly once under contention", "[sync]") {
+    const uint64_t n = 200000;
+    ChaseLevDeque<uint64_t> d(16);
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> stolen_sum{0};
+    std::atomic<uint64_t> stolen{0};
+
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < 3; ++i)
+        thieves.emplace_back([&] {
+            while (!done.load() || !d.is_empty()) {
+                Option<uint64_t> v = d.steal();
+                if (v.is_some()) {
+                    stolen_sum += v.unwrap();
+                    ++stolen;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+    uint64_t popped_sum = 0;
+    uint64_t popped = 0;
+    for (uint64_t i = 1; i <= n; ++i) {
+        d.push(i);
+        if (i % 3 == 0) {
+            Option<uint64_t> v = d.pop();
+            if (v.is_some()) {
+                popped_sum += v.unwrap();
+                ++popped;
+            }
+        }
+    }
+    for (Option<uint64_t> v = d.pop(); v.is_some(); v = d.pop()) {
+        popped_sum += v.unwrap();
+        ++popped;
+    }
+    done = true;
+    for (std::thread &t : thieves)
+        t.join();
+
+    REQUIRE(popped + stolen == n);
+    REQUIRE(popped_sum + stolen_sum == n * (n + 1) / 2);
+}
@@ -0,0 +1,110 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "sync/MpmcQueue.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace rustish::option;
+using namespace rustish::sync;
+
+TEST_CASE("MpmcQueue is FIFO on one thread", "[sync]") {
+    MpmcQueue<int> q(4);
+    REQUIRE(q.capacity() == 4);
+    REQUIRE(q.try_pop().is_none());
+
+    for (int i = 0; i < 4; ++i)
+        REQUIRE(q.try_push(i).is_none());
+    REQUIRE(q.try_push(9).unwrap() == 9);
+
+    for (int i = 0; i < 4; ++i)
+        REQUIRE(q.try_pop().unwrap() == i);
+    REQUIRE(q.try_pop().is_none());
+}
+
+TEST_CASE("MpmcQueue wraps around its slots", "[sync]") {
+    MpmcQueue<uint32_t> q(2);
+    for (uint32_t i = 0; i < 1000; ++i) {
+        REQUIRE(q.try_push(i).is_none());
+        REQUIRE(q.try_pop().unwrap() == i);
+    }
+}
+
+TEST_CASE("MpmcQueue hands move-only values back", "[sync]") {
+    MpmcQueue<std::unique_ptr<int>> q(2);
+    REQUIRE(q.try_push(std::unique_ptr<int>(new int(1))).is_none());
+    REQUIRE(q.try_push(std::unique_ptr<int>(new int(2))).is_none());
+    REQUIRE(*q.try_push(std::unique_ptr<int>(new int(3))).unwrap() == 3);
+    REQUIRE(*q.pop().unwrap() == 1);
+}
+
+TEST_CASE("closed MpmcQueue drains then returns None", "[sync]") {
+    MpmcQueue<int> q(8);
+    q.push(1);
+    q.push(2);
+    q.close();
+
+    REQUIRE(q.is_closed());
+    REQUIRE(q.push(3).unwrap() == 3);
+    REQUIRE(q.pop().unwrap() == 1);
+    REQUIRE(q.pop().unwrap() == 2);
+    REQUIRE(q.pop().is_none());
+}
+
+TEST_CASE("close wakes blocked consumers", "[sync]") {
+    MpmcQueue<int> q(8);
+    std::atomic<int> finished{0};
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < 4; ++i)
+        consumers.emplace_back([&] {
+            while (q.pop().is_some()) {
+            }
+            ++finished;
+        });
+
+    q.push(1);
+    q.close();
+    for (std::thread &t : consumers)
+        t.join();
+    REQUIRE(finished == 4);
+}
+
+TEST_CASE("MpmcQueue delivers every value exactly once", "[sync]") {
+    const int producers = 4;
+    const int consumers = 4;
+    const uint64_t per_producer = 50000;
+    MpmcQueue<uint64_t> q(64);
+
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> count{0};
+    std::vector<std::thread> threads;
+    for (int c = 0; c < consumers; ++c)
+        threads.emplace_back([&] {
+            for (;;) {
+                Option<uint64_t> v = q.pop();
+                if (v.is_none())
+                    return;
+                sum += v.unwrap();
+                ++count;
+            }
+        });
+
+    std::vector<std::thread> pushers;
+    for (int p = 0; p < producers; ++p)
+        pushers.emplace_back([&, p] {
+            for (uint64_t i = 0; i < per_producer; ++i)
+                q.push(p * per_producer + i);
+        });
+    for (std::thread &t : pushers)
+        t.join();
+    q.close();
+    for (std::thread &t : threads)
+        t.join();
+
+    uint64_t n = producers * per_producer;
+    REQUIRE(count == n);
+    REQUIRE(sum == n * (n - 1) / 2);
+}
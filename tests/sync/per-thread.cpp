@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "sync/PerThread.hpp"
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rustish::option;
+using namespace rustish::sync;
+
+namespace {
+
+struct Counted {
+    static int live;
+
+    Counted() { ++live; }
+    Counted(const Counted &) { ++live; }
+    Counted(Counted &&) { ++live; }
+    ~Counted() { --live; }
+};
+
+int Counted::live = 0;
+
+} // namespace
+
+TEST_CASE("CachePadded fills whole cache lines", "[sync]") {
+    REQUIRE(sizeof(CachePadded<Option<int>>) == cache_line_size);
+    REQUIRE(alignof(CachePadded<Option<int>>) == cache_line_size);
+    REQUIRE(sizeof(CachePadded<char[65]>) == 2 * cache_line_size);
+
+    CachePadded<Option<int>> padded(Some(3));
+    REQUIRE(padded->is_some());
+    REQUIRE((*padded).unwrap() == 3);
+}
+
+TEST_CASE("PerThread slots are on separate cache lines", "[sync]") {
+    PerThread<Option<uint64_t>> slots(5);
+    REQUIRE(slots.len() == 5);
+    for (size_t i = 0; i < slots.len(); ++i) {
+        uintptr_t addr = reinterpret_cast<uintptr_t>(&slots[i]);
+        REQUIRE(addr % cache_line_size == 0);
+        REQUIRE(slots[i].is_none());
+        if (i > 0)
+            REQUIRE(addr - reinterpret_cast<uintptr_t>(&slots[i - 1]) ==
+                    cache_line_size);
+    }
+}
+
+TEST_CASE("PerThread::get checks the index", "[sync]") {
+    PerThread<Option<int>> slots(2);
+    slots[1] = 4;
+    REQUIRE(slots.get(1).unwrap().unwrap() == 4);
+    REQUIRE(slots.get(2).is_none());
+}
+
+TEST_CASE("gather collects Some values in slot order", "[sync]") {
+    PerThread<Option<std::string>> slots(4);
+    slots[0] = "a";
+    slots[2] = "c";
+    slots[3] = "d";
+
+    std::vector<std::string> values = gather(slots);
+    REQUIRE(values == std::vector<std::string>{"a", "c", "d"});
+    for (size_t i = 0; i < slots.len(); ++i)
+        REQUIRE(slots[i].is_none());
+    REQUIRE(gather(slots).empty());
+}
+
+TEST_CASE("threads publish results to their own slots", "[sync]") {
+    const size_t threads = 8;
+    PerThread<Option<uint64_t>> slots(threads);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&slots, t] {
+            if (t % 2 == 0)
+                slots[t] = Option<uint64_t>(t * 10);
+        });
+    }
+    for (std::thread &w : workers)
+        w.join();
+
+    REQUIRE(gather(slots) == std::vector<uint64_t>{0, 20, 40, 60});
+}
+
+TEST_CASE("PerThread destroys its slots", "[sync]") {
+    {
+        PerThread<Option<Counted>> slots(3);
+        slots[0] = Counted();
+        slots[2] = Counted();
+        REQUIRE(Counted::live == 2);
+    }
+    REQUIRE(Counted::live == 0);
+}
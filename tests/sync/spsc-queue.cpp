@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "sync/SpscQueue.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+using namespace rustish::option;
+using namespace rustish::sync;
+
+namespace {
+
+struct Counted {
+    static int live;
+
+    Counted() { ++live; }
+    Counted(const Counted &) { ++live; }
+    Counted(Counted &&) { ++live; }
+    ~Counted() { --live; }
+};
+
+int Counted::live = 0;
+
+} // namespace
+
+TEST_CASE("SpscQueue is FIFO", "[sync]") {
+    SpscQueue<int> q(4);
+    REQUIRE(q.is_empty());
+    REQUIRE(q.try_pop().is_none());
+
+    for (int i = 0; i < 3; ++i)
+        REQUIRE(q.try_push(i).is_none());
+    REQUIRE(q.len() == 3);
+    for (int i = 0; i < 3; ++i)
+        REQUIRE(q.try_pop().unwrap() == i);
+    REQUIRE(q.try_pop().is_none());
+}
+
+TEST_CASE("SpscQueue capacity rounds up to a power of two", "[sync]") {
+    SpscQueue<int> q(5);
+    REQUIRE(q.capacity() == 8);
+}
+
+TEST_CASE("SpscQueue try_push hands the value back when full", "[sync]") {
+    SpscQueue<std::unique_ptr<int>> q(2);
+    REQUIRE(q.try_push(std::unique_ptr<int>(new int(1))).is_none());
+    REQUIRE(q.try_push(std::unique_ptr<int>(new int(2))).is_none());
+
+    Option<std::unique_ptr<int>> rejected =
+        q.try_push(std::unique_ptr<int>(new int(3)));
+    REQUIRE(rejected.is_some());
+    REQUIRE(*rejected.unwrap() == 3);
+
+    REQUIRE(*q.try_pop().unwrap() == 1);
+    REQUIRE(q.try_push(std::unique_ptr<int>(new int(4))).is_none());
+    REQUIRE(*q.try_pop().unwrap() == 2);
+    REQUIRE(*q.try_pop().unwrap() == 4);
+}
+
+TEST_CASE("SpscQueue wraps around its slots", "[sync]") {
+    SpscQueue<uint32_t> q(4);
+    for (uint32_t i = 0; i < 1000; ++i) {
+        REQUIRE(q.try_push(i).is_none());
+        REQUIRE(q.try_push(i + 1).is_none());
+        REQUIRE(q.try_pop().unwrap() == i);
+        REQUIRE(q.try_pop().unwrap() == i + 1);
+    }
+    REQUIRE(q.is_empty());
+}
+
+TEST_CASE("SpscQueue destroys values left in it", "[sync]") {
+    {
+        SpscQueue<Counted> q(8);
+        for (int i = 0; i < 5; ++i)
+            q.try_push(Counted());
+        q.try_pop();
+        REQUIRE(Counted::live == 4);
+    }
+    REQUIRE(Counted::live == 0);
+}
+
+TEST_CASE("SpscQueue passes values between two threads", "[sync]") {
+    const uint64_t n = 1000000;
+    SpscQueue<uint64_t> q(64);
+
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < n; ++i) {
+            Option<uint64_t> v = Option<uint64_t>(i);
+            while ((v = q.try_push(v.unwrap())).is_some())
+                std::this_thread::yield();
+        }
+    });
+
+    uint64_t expected = 0;
+    bool ordered = true;
+    while (expected < n) {
+        Option<uint64_t> v = q.try_pop();
+        if (v.is_some())
+            ordered &= v.unwrap() == expected++;
+        else
+            std::this_thread::yield();
+    }
+    producer.join();
+
+    REQUIRE(ordered);
+    REQUIRE(q.is_empty());
+}